@@ -1,7 +1,11 @@
-use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
 use tempfile::TempDir;
 use vrift_cas::CasStore;
 
+/// Blob-size distribution seen in real builds: small sources, medium
+/// objects, large artifacts
+const BLOB_SIZES: &[(usize, &str)] = &[(4 * 1024, "4kb"), (64 * 1024, "64kb"), (1024 * 1024, "1mb")];
+
 fn bench_cas_store(c: &mut Criterion) {
     let temp = TempDir::new().unwrap();
     let cas = CasStore::new(temp.path()).unwrap();
@@ -40,5 +44,40 @@ fn bench_cas_get_mmap(c: &mut Criterion) {
     });
 }
 
-criterion_group!(benches, bench_cas_store, bench_cas_get, bench_cas_get_mmap);
+/// Store/get across the blob-size distribution, with byte throughput so
+/// regressions are visible per size class rather than averaged away
+fn bench_cas_blob_sizes(c: &mut Criterion) {
+    let temp = TempDir::new().unwrap();
+    let cas = CasStore::new(temp.path()).unwrap();
+
+    let mut group = c.benchmark_group("cas_store_sized");
+    for &(size, label) in BLOB_SIZES {
+        let data = vec![0x5Au8; size];
+        group.throughput(Throughput::Bytes(size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(label), &data, |b, data| {
+            // Repeated same-content stores measure the dedup check path
+            b.iter(|| cas.store(black_box(data)).unwrap())
+        });
+    }
+    group.finish();
+
+    let mut group = c.benchmark_group("cas_get_sized");
+    for &(size, label) in BLOB_SIZES {
+        let data = vec![0x5Au8; size];
+        let hash = cas.store(&data).unwrap();
+        group.throughput(Throughput::Bytes(size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(label), &hash, |b, hash| {
+            b.iter(|| cas.get(black_box(hash)).unwrap())
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_cas_store,
+    bench_cas_get,
+    bench_cas_get_mmap,
+    bench_cas_blob_sizes
+);
 criterion_main!(benches);
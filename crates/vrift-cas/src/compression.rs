@@ -0,0 +1,130 @@
+//! Transparent zstd compression for cold CAS blobs.
+//!
+//! Cold blobs are re-encoded in place as `hash_size.zst` (the size in the
+//! filename stays the ORIGINAL size, so integrity checks and lookups keep
+//! working). `CasStore::get`/`get_mmap` decompress transparently; hot blobs
+//! remain raw so the mmap read path stays zero-copy, and the link farm
+//! rehydrates a compressed blob before projecting it.
+//!
+//! The binding is loaded from the system libzstd via `dlopen` at first use —
+//! no build-time dependency, and everything degrades gracefully to "no
+//! compression tier" when the library is absent. (The zstd crate is not in
+//! our dependency set; the distro library is universally available on the
+//! builders this tier targets.)
+
+use std::ffi::CStr;
+use std::sync::OnceLock;
+
+/// Extension for compressed blobs in the fan-out
+pub const ZST_EXT: &str = "zst";
+
+/// Compression level for cold-blob demotion. One-time cost at demotion,
+/// paid back on every cold read — favor ratio over speed.
+pub const DEFAULT_ZSTD_LEVEL: i32 = 9;
+
+type CompressBoundFn = unsafe extern "C" fn(usize) -> usize;
+type CompressFn = unsafe extern "C" fn(*mut u8, usize, *const u8, usize, i32) -> usize;
+type DecompressFn = unsafe extern "C" fn(*mut u8, usize, *const u8, usize) -> usize;
+type IsErrorFn = unsafe extern "C" fn(usize) -> u32;
+
+struct ZstdLib {
+    compress_bound: CompressBoundFn,
+    compress: CompressFn,
+    decompress: DecompressFn,
+    is_error: IsErrorFn,
+}
+
+// Safety: the struct only holds C function pointers into a library that is
+// never unloaded (dlopen without dlclose).
+unsafe impl Send for ZstdLib {}
+unsafe impl Sync for ZstdLib {}
+
+static ZSTD: OnceLock<Option<ZstdLib>> = OnceLock::new();
+
+/// Candidate library names, most specific first
+#[cfg(target_os = "linux")]
+const LIB_NAMES: &[&CStr] = &[c"libzstd.so.1", c"libzstd.so"];
+#[cfg(target_os = "macos")]
+const LIB_NAMES: &[&CStr] = &[c"libzstd.1.dylib", c"libzstd.dylib"];
+#[cfg(not(any(target_os = "linux", target_os = "macos")))]
+const LIB_NAMES: &[&CStr] = &[];
+
+fn load() -> Option<ZstdLib> {
+    let handle = LIB_NAMES.iter().find_map(|name| {
+        let h = unsafe { libc::dlopen(name.as_ptr(), libc::RTLD_NOW | libc::RTLD_LOCAL) };
+        (!h.is_null()).then_some(h)
+    })?;
+
+    unsafe {
+        let sym = |name: &CStr| {
+            let p = libc::dlsym(handle, name.as_ptr());
+            (!p.is_null()).then_some(p)
+        };
+        Some(ZstdLib {
+            compress_bound: std::mem::transmute::<*mut libc::c_void, CompressBoundFn>(sym(
+                c"ZSTD_compressBound",
+            )?),
+            compress: std::mem::transmute::<*mut libc::c_void, CompressFn>(sym(c"ZSTD_compress")?),
+            decompress: std::mem::transmute::<*mut libc::c_void, DecompressFn>(sym(
+                c"ZSTD_decompress",
+            )?),
+            is_error: std::mem::transmute::<*mut libc::c_void, IsErrorFn>(sym(c"ZSTD_isError")?),
+        })
+    }
+}
+
+fn lib() -> Option<&'static ZstdLib> {
+    ZSTD.get_or_init(load).as_ref()
+}
+
+/// Whether the compression tier can operate on this host
+pub fn zstd_available() -> bool {
+    lib().is_some()
+}
+
+/// Compress a buffer. None if libzstd is unavailable or compression fails.
+pub fn compress(data: &[u8], level: i32) -> Option<Vec<u8>> {
+    let z = lib()?;
+    unsafe {
+        let bound = (z.compress_bound)(data.len());
+        let mut out = vec![0u8; bound];
+        let written = (z.compress)(out.as_mut_ptr(), bound, data.as_ptr(), data.len(), level);
+        if (z.is_error)(written) != 0 {
+            return None;
+        }
+        out.truncate(written);
+        Some(out)
+    }
+}
+
+/// Decompress a buffer whose original size is known (from the blob
+/// filename). None on unavailability, error, or size mismatch.
+pub fn decompress(data: &[u8], raw_size: usize) -> Option<Vec<u8>> {
+    let z = lib()?;
+    unsafe {
+        let mut out = vec![0u8; raw_size];
+        let written = (z.decompress)(out.as_mut_ptr(), raw_size, data.as_ptr(), data.len());
+        if (z.is_error)(written) != 0 || written != raw_size {
+            return None;
+        }
+        Some(out)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_compress_roundtrip_when_available() {
+        if !zstd_available() {
+            eprintln!("libzstd not present — compression tier disabled, skipping");
+            return;
+        }
+        let data = vec![0x42u8; 64 * 1024];
+        let compressed = compress(&data, DEFAULT_ZSTD_LEVEL).unwrap();
+        assert!(compressed.len() < data.len());
+        let restored = decompress(&compressed, data.len()).unwrap();
+        assert_eq!(restored, data);
+    }
+}
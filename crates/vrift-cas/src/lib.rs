@@ -22,11 +22,13 @@
 //! - macOS: GCD-style dispatch
 //! - Fallback: Rayon thread pool
 
+pub mod compression;
 mod io_backend;
 pub mod link_strategy;
 pub mod parallel_ingest;
 pub mod protection;
 pub mod reflink;
+pub mod shared_bloom;
 pub mod streaming_ingest;
 pub mod streaming_pipeline;
 pub mod zero_copy_ingest;
@@ -43,6 +45,7 @@ pub use parallel_ingest::{
 pub use protection::{
     enforce_cas_invariant, is_immutable, set_immutable, CAS_FORBIDDEN_PERM_MASK, CAS_READ_ONLY_PERM,
 };
+pub use shared_bloom::SharedBloom;
 pub use streaming_ingest::{
     streaming_ingest, streaming_ingest_cached, streaming_ingest_with_progress,
 };
@@ -65,6 +68,13 @@ use thiserror::Error;
 /// BLAKE3 hash type (32 bytes)
 pub type Blake3Hash = [u8; 32];
 
+/// Size gate for multi-threaded hashing.
+///
+/// Below this, rayon fork/join overhead beats the speedup — and during
+/// parallel ingest the cores are already busy with per-file parallelism.
+/// Above it (debug binaries run 2-4GB) one file saturates all cores.
+pub const PARALLEL_HASH_THRESHOLD: usize = 16 * 1024 * 1024; // 16MB
+
 /// Errors that can occur during CAS operations
 #[derive(Error, Debug)]
 pub enum CasError {
@@ -83,9 +93,40 @@ pub type Result<T> = std::result::Result<T, CasError>;
 /// Content-Addressable Storage store
 ///
 /// Stores blobs indexed by their BLAKE3 hash with a 2-char prefix fan-out.
-#[derive(Debug, Clone)]
+#[derive(Clone)]
 pub struct CasStore {
     root: PathBuf,
+
+    /// Optional pack tier consulted on loose-blob misses (RFC-0039 §7).
+    /// Implemented by vrift-pack's `PackSet`; None until attached.
+    pack_tier: Option<std::sync::Arc<dyn PackTier>>,
+
+    /// Persistent shared existence filter over stored hashes; None if the
+    /// filter file could not be opened (callers fall back to fs checks).
+    exists_bloom: Option<std::sync::Arc<SharedBloom>>,
+}
+
+impl std::fmt::Debug for CasStore {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("CasStore")
+            .field("root", &self.root)
+            .field("pack_tier", &self.pack_tier.is_some())
+            .field("exists_bloom", &self.exists_bloom.is_some())
+            .finish()
+    }
+}
+
+/// Read-only blob tier backed by pack files.
+///
+/// Lives here (rather than in vrift-pack) so `CasStore::get`/`exists` can
+/// consult it without a circular dependency — vrift-pack implements it for
+/// `PackSet` and migrates cold small blobs out of the loose fan-out.
+pub trait PackTier: Send + Sync {
+    /// Whether the tier holds this blob
+    fn contains(&self, hash: &Blake3Hash) -> bool;
+
+    /// Fetch a blob's bytes, or None if not packed
+    fn get(&self, hash: &Blake3Hash) -> Option<Vec<u8>>;
 }
 
 impl CasStore {
@@ -95,7 +136,18 @@ impl CasStore {
     pub fn new<P: AsRef<Path>>(root: P) -> Result<Self> {
         let root = root.as_ref().to_path_buf();
         fs::create_dir_all(&root)?;
-        Ok(Self { root })
+        let exists_bloom = SharedBloom::for_cas_root(&root);
+        Ok(Self {
+            root,
+            pack_tier: None,
+            exists_bloom,
+        })
+    }
+
+    /// Attach a pack tier; `get`/`get_mmap`/`exists` consult it after a
+    /// loose-blob miss.
+    pub fn set_pack_tier(&mut self, tier: std::sync::Arc<dyn PackTier>) {
+        self.pack_tier = Some(tier);
     }
 
     /// Create a CAS store at the default location (`~/.vrift/the_source/`).
@@ -107,9 +159,19 @@ impl CasStore {
     }
 
     /// Compute the BLAKE3 hash of the given bytes.
+    ///
+    /// BLAKE3 is a tree hash, so buffers at or above
+    /// [`PARALLEL_HASH_THRESHOLD`] are hashed with the rayon backend —
+    /// the result is bit-identical to the serial hash.
     #[inline]
     pub fn compute_hash(data: &[u8]) -> Blake3Hash {
-        *blake3::hash(data).as_bytes()
+        if data.len() >= PARALLEL_HASH_THRESHOLD {
+            let mut hasher = blake3::Hasher::new();
+            hasher.update_rayon(data);
+            *hasher.finalize().as_bytes()
+        } else {
+            *blake3::hash(data).as_bytes()
+        }
     }
 
     /// Convert a hash to its hex string representation.
@@ -146,7 +208,7 @@ impl CasStore {
     ///
     /// Returns the path if found, None otherwise.
     /// Only supports new format: `hash_size.ext` (with size and optional extension)
-    fn find_blob_path(&self, hash: &Blake3Hash) -> Option<PathBuf> {
+    pub fn find_blob_path(&self, hash: &Blake3Hash) -> Option<PathBuf> {
         let dir = self.blob_dir(hash);
         if !dir.exists() {
             return None;
@@ -167,6 +229,75 @@ impl CasStore {
         None
     }
 
+    /// Whether a blob file is stored in the compressed cold tier.
+    ///
+    /// Public so maintenance passes outside this crate (e.g. pack
+    /// compaction) can skip tiered blobs, whose raw bytes intentionally
+    /// don't hash to their filename.
+    pub fn is_compressed_blob(path: &Path) -> bool {
+        path.extension()
+            .is_some_and(|ext| ext == compression::ZST_EXT)
+    }
+
+    /// Whether a blob file is a CDC chunk index (large artifacts ingested
+    /// via `zero_copy_ingest::ingest_cdc`).
+    pub fn is_chunked_blob(path: &Path) -> bool {
+        path.extension()
+            .is_some_and(|ext| ext == zero_copy_ingest::CDC_EXT)
+    }
+
+    /// Reassemble a CDC-chunked blob from its index and chunk blobs.
+    ///
+    /// Each chunk fetch goes through `get()`, so per-chunk hashes are
+    /// verified (and cold-compressed chunks inflate transparently). Callers
+    /// verify the whole-file hash afterwards.
+    fn reconstruct_chunked(&self, index_path: &Path) -> Result<Vec<u8>> {
+        let index_bytes = fs::read(index_path)?;
+        let chunks = zero_copy_ingest::decode_chunk_index(&index_bytes)?;
+        let total: u64 = chunks.iter().map(|c| c.size).sum();
+        let mut data = Vec::with_capacity(total as usize);
+        for chunk in &chunks {
+            data.extend_from_slice(&self.get(&chunk.hash)?);
+        }
+        Ok(data)
+    }
+
+    /// Original (uncompressed) size of a blob, parsed from its
+    /// self-describing `hash_size[.ext][.zst]` filename.
+    fn blob_raw_size(path: &Path) -> Option<u64> {
+        let name = path.file_name()?.to_str()?;
+        let stem = name.split('.').next()?;
+        stem.rsplit('_').next()?.parse().ok()
+    }
+
+    /// Read a blob file, transparently decompressing the cold tier.
+    ///
+    /// Uncompressed blobs go through a plain read; `.zst` blobs are inflated
+    /// to the original size recorded in the filename. Callers verify the
+    /// BLAKE3 hash afterwards, which also covers decompression integrity.
+    fn read_blob_file(path: &Path) -> Result<Vec<u8>> {
+        let mut file = File::open(path)?;
+        let mut data = Vec::new();
+        file.read_to_end(&mut data)?;
+
+        if Self::is_compressed_blob(path) {
+            let raw_size = Self::blob_raw_size(path).ok_or_else(|| {
+                CasError::Io(io::Error::other(format!(
+                    "compressed blob has malformed filename: {}",
+                    path.display()
+                )))
+            })?;
+            return compression::decompress(&data, raw_size as usize).ok_or_else(|| {
+                CasError::Io(io::Error::other(format!(
+                    "zstd decompression failed for {}",
+                    path.display()
+                )))
+            });
+        }
+
+        Ok(data)
+    }
+
     /// Get the path for a self-describing blob (RFC-0039 format).
     ///
     /// Format: `blake3/ab/cd/hash_size.ext`
@@ -194,8 +325,16 @@ impl CasStore {
         let hash = Self::compute_hash(data);
         let size = data.len() as u64;
 
-        // Deduplication: skip if already exists (check via find_blob_path)
-        if self.find_blob_path(&hash).is_some() {
+        // Deduplication: skip if already exists. A trusted filter negative
+        // means definitely absent, so the fan-out probe is skipped entirely.
+        let definitely_new = self
+            .exists_bloom
+            .as_ref()
+            .is_some_and(|b| b.definitely_absent(&hash));
+        if !definitely_new && self.find_blob_path(&hash).is_some() {
+            if let Some(bloom) = &self.exists_bloom {
+                bloom.add(&hash); // Self-heal: make the hit a filter hit too
+            }
             return Ok(hash);
         }
 
@@ -238,6 +377,10 @@ impl CasStore {
             let _ = fs::set_permissions(&path, fs::Permissions::from_mode(0o444));
         }
 
+        if let Some(bloom) = &self.exists_bloom {
+            bloom.add(&hash);
+        }
+
         Ok(hash)
     }
 
@@ -255,6 +398,21 @@ impl CasStore {
         Ok(*hasher.finalize().as_bytes())
     }
 
+    /// Compute the BLAKE3 hash of an open file.
+    ///
+    /// Files at or above [`PARALLEL_HASH_THRESHOLD`] are memory-mapped and
+    /// hashed across all cores; smaller files stream through the serial
+    /// reader path to avoid mmap setup overhead.
+    pub fn compute_hash_file(file: &File, size: u64) -> io::Result<Blake3Hash> {
+        if size as usize >= PARALLEL_HASH_THRESHOLD {
+            // SAFETY: mmap requires a valid file descriptor
+            let mmap = unsafe { memmap2::Mmap::map(file)? };
+            Ok(Self::compute_hash(&mmap))
+        } else {
+            Self::compute_hash_reader(file)
+        }
+    }
+
     /// Store a file in the CAS by moving it from the given source path.
     ///
     /// This is a zero-copy operation if the source and CAS are on the same filesystem.
@@ -266,10 +424,18 @@ impl CasStore {
         let src = src_path.as_ref();
         let file = File::open(src)?;
         let size = file.metadata()?.len();
-        let hash = Self::compute_hash_reader(file)?;
-
-        // Deduplication: if already exists, just remove the temp file
-        if self.find_blob_path(&hash).is_some() {
+        let hash = Self::compute_hash_file(&file, size)?;
+
+        // Deduplication: if already exists, just remove the temp file.
+        // A trusted filter negative skips the fan-out probe.
+        let definitely_new = self
+            .exists_bloom
+            .as_ref()
+            .is_some_and(|b| b.definitely_absent(&hash));
+        if !definitely_new && self.find_blob_path(&hash).is_some() {
+            if let Some(bloom) = &self.exists_bloom {
+                bloom.add(&hash);
+            }
             let _ = fs::remove_file(src);
             return Ok(hash);
         }
@@ -303,6 +469,10 @@ impl CasStore {
             let _ = fs::set_permissions(&path, fs::Permissions::from_mode(0o444));
         }
 
+        if let Some(bloom) = &self.exists_bloom {
+            bloom.add(&hash);
+        }
+
         Ok(hash)
     }
 
@@ -321,15 +491,21 @@ impl CasStore {
         let path = match self.find_blob_path(hash) {
             Some(p) => p,
             None => {
+                // Loose miss — consult the pack tier before failing
+                if let Some(data) = self.get_packed(hash) {
+                    return Ok(data);
+                }
                 return Err(CasError::NotFound {
                     hash: Self::hash_to_hex(hash),
                 })
             }
         };
 
-        let mut file = File::open(&path)?;
-        let mut data = Vec::new();
-        file.read_to_end(&mut data)?;
+        let data = if Self::is_chunked_blob(&path) {
+            self.reconstruct_chunked(&path)?
+        } else {
+            Self::read_blob_file(&path)?
+        };
 
         // Verify hash on read (integrity check)
         let actual_hash = Self::compute_hash(&data);
@@ -343,9 +519,39 @@ impl CasStore {
         Ok(data)
     }
 
-    /// Check if a blob exists in the CAS.
+    /// Check if a blob exists in the CAS (loose or packed).
+    ///
+    /// A trusted negative from the shared existence filter answers "not
+    /// loose" without touching the fan-out; positives (and an invalid
+    /// filter) verify against the filesystem as before.
     pub fn exists(&self, hash: &Blake3Hash) -> bool {
-        self.find_blob_path(hash).is_some()
+        let loose = if self
+            .exists_bloom
+            .as_ref()
+            .is_some_and(|b| b.definitely_absent(hash))
+        {
+            false
+        } else {
+            self.find_blob_path(hash).is_some()
+        };
+        loose
+            || self
+                .pack_tier
+                .as_ref()
+                .is_some_and(|tier| tier.contains(hash))
+    }
+
+    /// Fetch a blob from the pack tier, verifying its hash on read
+    fn get_packed(&self, hash: &Blake3Hash) -> Option<Vec<u8>> {
+        let data = self.pack_tier.as_ref()?.get(hash)?;
+        if Self::compute_hash(&data) != *hash {
+            tracing::warn!(
+                "Pack tier returned corrupt blob for {}",
+                Self::hash_to_hex(hash)
+            );
+            return None;
+        }
+        Some(data)
     }
 
     /// Delete a blob from the CAS.
@@ -449,12 +655,36 @@ impl CasStore {
         let path = match self.find_blob_path(hash) {
             Some(p) => p,
             None => {
+                // Pack-resident blobs are small; serve them from an anonymous
+                // map so the signature stays the same. The pack itself is
+                // already mmap'd, so the extra copy is a few KB.
+                if let Some(data) = self.get_packed(hash) {
+                    let mut anon =
+                        memmap2::MmapMut::map_anon(data.len().max(1)).map_err(io::Error::other)?;
+                    anon[..data.len()].copy_from_slice(&data);
+                    return anon.make_read_only().map_err(|e| CasError::Io(e.into()));
+                }
                 return Err(CasError::NotFound {
                     hash: Self::hash_to_hex(hash),
                 })
             }
         };
 
+        // Cold-tier and CDC-chunked blobs cannot be mapped directly —
+        // materialize into an anonymous map. Hot (uncompressed, whole)
+        // blobs below keep the zero-copy page-cache-shared path.
+        if Self::is_compressed_blob(&path) || Self::is_chunked_blob(&path) {
+            let data = if Self::is_chunked_blob(&path) {
+                self.reconstruct_chunked(&path)?
+            } else {
+                Self::read_blob_file(&path)?
+            };
+            let mut anon =
+                memmap2::MmapMut::map_anon(data.len().max(1)).map_err(io::Error::other)?;
+            anon[..data.len()].copy_from_slice(&data);
+            return anon.make_read_only().map_err(|e| CasError::Io(e.into()));
+        }
+
         let file = File::open(&path)?;
         // Safety: The file is read-only and we're not modifying it
         let mmap = unsafe { memmap2::Mmap::map(&file) }.map_err(io::Error::other)?;
@@ -486,43 +716,273 @@ impl CasStore {
 
     /// Perform a Garbage Collection sweep using a Bloom Filter of active hashes.
     ///
+    /// The fan-out layout (blake3/ab/cd) gives 256 independent first-level
+    /// shards, so both passes run on the rayon pool with one shard per task:
+    /// the mark pass collects chunk hashes reachable from live CDC indexes
+    /// (manifests reference whole-file hashes, not chunks), the delete pass
+    /// removes everything in neither set. Shards never overlap, so there is
+    /// no cross-task coordination beyond the final reduce.
+    ///
     /// Returns (deleted_count, reclaimed_bytes).
     pub fn sweep(&self, bloom_bits: &[u8]) -> Result<(u32, u64)> {
+        use rayon::prelude::*;
+
         let bloom = BloomFilter {
             bits: bloom_bits.to_vec(),
         };
+        let shards = self.shard_dirs()?;
+
+        // Mark pass: per-shard chunk-keep sets, unioned after the join
+        let chunk_sets: Vec<std::collections::HashSet<Blake3Hash>> = shards
+            .par_iter()
+            .map(|shard| {
+                let mut keep = std::collections::HashSet::new();
+                for hash in Self::shard_hashes(shard) {
+                    if !bloom.contains(&Self::hash_to_hex(&hash)) {
+                        continue;
+                    }
+                    if let Some(path) = self.find_blob_path(&hash) {
+                        if Self::is_chunked_blob(&path) {
+                            let index_bytes = fs::read(&path)?;
+                            for chunk in zero_copy_ingest::decode_chunk_index(&index_bytes)? {
+                                keep.insert(chunk.hash);
+                            }
+                        }
+                    }
+                }
+                Ok(keep)
+            })
+            .collect::<Result<_>>()?;
+        let mut chunk_keep = std::collections::HashSet::new();
+        for set in chunk_sets {
+            chunk_keep.extend(set);
+        }
 
-        let mut deleted_count = 0;
-        let mut reclaimed_bytes = 0;
-
-        for hash_res in self.iter()? {
-            let hash = hash_res?;
-
-            // Convert Blake3Hash ([u8; 32]) to hex string for bloom lookup
-            let hex = Self::hash_to_hex(&hash);
-
-            if !bloom.contains(&hex) {
-                // Potential orphan (not in Bloom Filter)
-                if let Some(path) = self.find_blob_path(&hash) {
-                    if let Ok(meta) = fs::metadata(&path) {
-                        let size = meta.len();
-                        // Delete the blob (handles immutable flags internally)
-                        if self.delete(&hash).is_ok() {
-                            deleted_count += 1;
-                            reclaimed_bytes += size;
+        // Delete pass: each shard reports (deleted, reclaimed), summed
+        let (deleted_count, reclaimed_bytes) = shards
+            .par_iter()
+            .map(|shard| {
+                let mut deleted = 0u32;
+                let mut reclaimed = 0u64;
+                for hash in Self::shard_hashes(shard) {
+                    if bloom.contains(&Self::hash_to_hex(&hash)) || chunk_keep.contains(&hash) {
+                        continue;
+                    }
+                    // Potential orphan (not in Bloom Filter)
+                    if let Some(path) = self.find_blob_path(&hash) {
+                        if let Ok(meta) = fs::metadata(&path) {
+                            let size = meta.len();
+                            // Delete the blob (handles immutable flags internally)
+                            if self.delete(&hash).is_ok() {
+                                deleted += 1;
+                                reclaimed += size;
+                            }
                         }
                     }
                 }
+                (deleted, reclaimed)
+            })
+            .reduce(|| (0, 0), |a, b| (a.0 + b.0, a.1 + b.1));
+
+        // Deletes never clear existence-filter bits, so a mass deletion is
+        // the one event that inflates its false-positive rate: rebuild the
+        // filter from the surviving blobs to re-tighten it.
+        if deleted_count > 0 {
+            if let Some(bloom) = &self.exists_bloom {
+                bloom.rebuild(&self.root);
             }
         }
 
         Ok((deleted_count, reclaimed_bytes))
     }
 
+    /// First-level fan-out directories (blake3/ab) — the sweep work units
+    fn shard_dirs(&self) -> Result<Vec<PathBuf>> {
+        let blake3_dir = self.root.join("blake3");
+        if !blake3_dir.exists() {
+            return Ok(Vec::new());
+        }
+        let mut shards = Vec::new();
+        for entry in fs::read_dir(&blake3_dir)? {
+            let entry = entry?;
+            if entry.file_type()?.is_dir() {
+                shards.push(entry.path());
+            }
+        }
+        Ok(shards)
+    }
+
+    /// All blob hashes under one ab/ shard (same filename parsing as
+    /// [`CasIterator`]: skip .tmp, strip the `_size` suffix). Unreadable
+    /// entries are skipped — a sweep must not abort on a racing delete.
+    fn shard_hashes(shard: &Path) -> Vec<Blake3Hash> {
+        let mut hashes = Vec::new();
+        let Ok(l2) = fs::read_dir(shard) else {
+            return hashes;
+        };
+        for l2_entry in l2.flatten() {
+            if !l2_entry.file_type().is_ok_and(|t| t.is_dir()) {
+                continue;
+            }
+            let Ok(l3) = fs::read_dir(l2_entry.path()) else {
+                continue;
+            };
+            for l3_entry in l3.flatten() {
+                let path = l3_entry.path();
+                if !path.is_file() || path.extension().is_some_and(|ext| ext == "tmp") {
+                    continue;
+                }
+                if let Some(filename) = path.file_name().and_then(|n| n.to_str()) {
+                    let hash_part = filename.split('_').next().unwrap_or(filename);
+                    if let Some(hash) = Self::hex_to_hash(hash_part) {
+                        hashes.push(hash);
+                    }
+                }
+            }
+        }
+        hashes
+    }
+
     pub fn blob_path_for_hash(&self, hash: &Blake3Hash) -> Option<PathBuf> {
         self.find_blob_path(hash)
     }
 
+    /// Demote cold blobs to the zstd compression tier.
+    ///
+    /// Walks the store (same traversal as `sweep()`) and re-encodes blobs
+    /// whose mtime is older than `min_age` as `hash_size.zst` — the filename
+    /// keeps the ORIGINAL size so lookups and integrity checks are unchanged.
+    /// Blobs that don't compress to below ~95% are left raw (already-packed
+    /// artifacts like .a/.o debug sections usually do; media files don't).
+    ///
+    /// Returns (compressed_count, bytes_saved). No-op when libzstd is absent.
+    pub fn compress_cold_blobs(
+        &self,
+        min_age: std::time::Duration,
+        level: i32,
+    ) -> Result<(u64, u64)> {
+        if !compression::zstd_available() {
+            tracing::warn!("libzstd unavailable — skipping cold-blob compression");
+            return Ok((0, 0));
+        }
+
+        let now = std::time::SystemTime::now();
+        let mut compressed_count = 0u64;
+        let mut bytes_saved = 0u64;
+
+        for hash_res in self.iter()? {
+            let hash = hash_res?;
+            let Some(path) = self.find_blob_path(&hash) else {
+                continue;
+            };
+            // Already demoted, or a CDC index (tiny, and its filename-encoded
+            // size describes the reconstructed file, not the index bytes)
+            if Self::is_compressed_blob(&path) || Self::is_chunked_blob(&path) {
+                continue;
+            }
+            let Ok(meta) = fs::metadata(&path) else {
+                continue;
+            };
+            if meta.len() < 4096 {
+                continue;
+            }
+            // Age gate: only demote blobs untouched for min_age
+            let is_cold = meta
+                .modified()
+                .ok()
+                .and_then(|mtime| now.duration_since(mtime).ok())
+                .is_some_and(|age| age >= min_age);
+            if !is_cold {
+                continue;
+            }
+
+            let data = fs::read(&path)?;
+            let Some(compressed) = compression::compress(&data, level) else {
+                continue;
+            };
+            // Skip incompressible content — keep it zero-copy
+            if compressed.len() * 100 >= data.len() * 95 {
+                continue;
+            }
+
+            // Atomic swap: write .zst via temp+rename, then drop the raw copy.
+            // Append (not replace) the extension so `hash_size.ext` blobs keep
+            // their type hint: `hash_size.ext.zst`.
+            let zst_path = path.with_file_name(format!(
+                "{}.{}",
+                path.file_name().unwrap().to_string_lossy(),
+                compression::ZST_EXT
+            ));
+            let temp_path = zst_path.with_extension("zst.tmp");
+            let mut file = File::create(&temp_path)?;
+            file.write_all(&compressed)?;
+            file.sync_all()?;
+            if let Err(e) = fs::rename(&temp_path, &zst_path) {
+                let _ = fs::remove_file(&temp_path);
+                return Err(e.into());
+            }
+
+            let _ = crate::protection::set_immutable(&path, false);
+            fs::remove_file(&path)?;
+
+            compressed_count += 1;
+            bytes_saved += data.len() as u64 - compressed.len() as u64;
+        }
+
+        tracing::info!(
+            "Compressed {} cold blobs, saved {} bytes",
+            compressed_count,
+            bytes_saved
+        );
+        Ok((compressed_count, bytes_saved))
+    }
+
+    /// Promote a compressed blob back to its raw form, returning the raw path.
+    ///
+    /// The link farm hardlinks/symlinks blobs into the project tree, which
+    /// only works on raw content — a blob about to be projected is hot again
+    /// by definition, so rehydration is the demotion's inverse.
+    fn rehydrate(&self, hash: &Blake3Hash, path: &Path) -> Result<PathBuf> {
+        let data = if Self::is_chunked_blob(path) {
+            // Chunks stay behind as loose blobs for the next build's dedup
+            self.reconstruct_chunked(path)?
+        } else if Self::is_compressed_blob(path) {
+            Self::read_blob_file(path)?
+        } else {
+            return Ok(path.to_path_buf());
+        };
+        let actual_hash = Self::compute_hash(&data);
+        if actual_hash != *hash {
+            return Err(CasError::HashMismatch {
+                expected: Self::hash_to_hex(hash),
+                actual: Self::hash_to_hex(&actual_hash),
+            });
+        }
+
+        // Raw path = tiered path minus the trailing .zst / .cdc
+        let name = path.file_name().unwrap().to_string_lossy().to_string();
+        let raw_name = name
+            .strip_suffix(".zst")
+            .or_else(|| name.strip_suffix(".cdc"))
+            .unwrap_or(&name);
+        let raw_path = path.with_file_name(raw_name);
+        let temp_path = raw_path.with_file_name(format!(
+            "{}.{}.rehydrate.tmp",
+            raw_path.file_name().unwrap().to_string_lossy(),
+            std::process::id()
+        ));
+        let mut file = File::create(&temp_path)?;
+        file.write_all(&data)?;
+        file.sync_all()?;
+        if let Err(e) = fs::rename(&temp_path, &raw_path) {
+            let _ = fs::remove_file(&temp_path);
+            return Err(e.into());
+        }
+        fs::remove_file(path).ok();
+
+        Ok(raw_path)
+    }
+
     /// Pre-create CAS directory structure to avoid per-file mkdir overhead.
     ///
     /// Creates the 3-level layout: blake3/{00..ff}/{00..ff}/
@@ -643,6 +1103,8 @@ impl CasStore {
             .ok_or_else(|| CasError::NotFound {
                 hash: Self::hash_to_hex(&hash),
             })?;
+        // Dedup may have hit a cold-tier copy — projections need raw content
+        let cas_path = self.rehydrate(&hash, &cas_path)?;
         let target = target_path.as_ref();
 
         // Remove existing file/symlink if present
@@ -687,6 +1149,8 @@ impl CasStore {
             .ok_or_else(|| CasError::NotFound {
                 hash: Self::hash_to_hex(&hash),
             })?;
+        // Dedup may have hit a cold-tier copy — projections need raw content
+        let cas_path = self.rehydrate(&hash, &cas_path)?;
         let target = target_path.as_ref();
 
         // Remove existing file if present
@@ -722,6 +1186,9 @@ impl CasStore {
                 hash: Self::hash_to_hex(hash),
             })?;
 
+        // A blob being projected is hot again — pull it out of the cold tier
+        let cas_path = self.rehydrate(hash, &cas_path)?;
+
         let target = target_path.as_ref();
 
         // Remove existing
@@ -746,6 +1213,9 @@ impl CasStore {
                 hash: Self::hash_to_hex(hash),
             })?;
 
+        // Hardlinks must point at raw content — rehydrate cold-tier blobs
+        let cas_path = self.rehydrate(hash, &cas_path)?;
+
         let target = target_path.as_ref();
 
         if target.exists() {
@@ -762,6 +1232,30 @@ impl CasStore {
         Ok(())
     }
 
+    /// Project many blobs as symlinks in parallel (rayon fan-out).
+    ///
+    /// A full workspace materialization is millions of independent link
+    /// syscalls — serializing them wastes every core but one. Returns the
+    /// number of projections created; fails fast on the first error.
+    #[cfg(unix)]
+    pub fn link_immutable_batch(&self, items: &[(Blake3Hash, PathBuf)]) -> Result<usize> {
+        use rayon::prelude::*;
+        items
+            .par_iter()
+            .try_for_each(|(hash, target)| self.link_immutable(hash, target))?;
+        Ok(items.len())
+    }
+
+    /// Project many blobs as hardlinks in parallel (rayon fan-out).
+    #[cfg(unix)]
+    pub fn link_mutable_batch(&self, items: &[(Blake3Hash, PathBuf)]) -> Result<usize> {
+        use rayon::prelude::*;
+        items
+            .par_iter()
+            .try_for_each(|(hash, target)| self.link_mutable(hash, target))?;
+        Ok(items.len())
+    }
+
     /// Set file to read-only (chmod 444).
     #[cfg(unix)]
     fn set_readonly(path: &Path) -> Result<()> {
@@ -944,6 +1438,65 @@ mod tests {
         assert_eq!(hash, parsed);
     }
 
+    #[test]
+    fn test_parallel_hash_matches_serial() {
+        // Cross the PARALLEL_HASH_THRESHOLD gate and check the rayon tree
+        // hash is bit-identical to the serial reference
+        let data = vec![0xA7u8; PARALLEL_HASH_THRESHOLD + 4096];
+        let parallel = CasStore::compute_hash(&data);
+        assert_eq!(parallel, *blake3::hash(&data).as_bytes());
+
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("big.bin");
+        fs::write(&path, &data).unwrap();
+        let file = File::open(&path).unwrap();
+        let from_file = CasStore::compute_hash_file(&file, data.len() as u64).unwrap();
+        assert_eq!(from_file, parallel);
+    }
+
+    #[test]
+    fn test_cold_compression_roundtrip() {
+        if !compression::zstd_available() {
+            eprintln!("libzstd not present — skipping cold tier test");
+            return;
+        }
+        let temp = TempDir::new().unwrap();
+        let cas = CasStore::new(temp.path()).unwrap();
+
+        // Compressible payload above the 4KB demotion floor
+        let data = vec![0x5Au8; 32 * 1024];
+        let hash = cas.store(&data).unwrap();
+
+        // Age gate of zero demotes immediately
+        let (count, saved) = cas
+            .compress_cold_blobs(std::time::Duration::ZERO, compression::DEFAULT_ZSTD_LEVEL)
+            .unwrap();
+        assert_eq!(count, 1);
+        assert!(saved > 0);
+
+        // Blob is now stored as .zst, read paths are transparent
+        let path = cas.find_blob_path(&hash).unwrap();
+        assert!(CasStore::is_compressed_blob(&path));
+        assert_eq!(cas.get(&hash).unwrap(), data);
+        assert_eq!(&cas.get_mmap(&hash).unwrap()[..], &data[..]);
+
+        // Projection rehydrates back to raw content
+        let target = temp.path().join("projected.bin");
+        cas.link_mutable(&hash, &target).unwrap();
+        assert_eq!(fs::read(&target).unwrap(), data);
+        let path = cas.find_blob_path(&hash).unwrap();
+        assert!(!CasStore::is_compressed_blob(&path));
+
+        // A second pass with a long age gate leaves the fresh blob alone
+        let (count, _) = cas
+            .compress_cold_blobs(
+                std::time::Duration::from_secs(3600),
+                compression::DEFAULT_ZSTD_LEVEL,
+            )
+            .unwrap();
+        assert_eq!(count, 0);
+    }
+
     #[test]
     fn test_empty_file() {
         let temp = TempDir::new().unwrap();
@@ -139,6 +139,25 @@ fn try_reflink_macos(src: &Path, dst: &Path) -> Result<(), ReflinkError> {
     }
 }
 
+/// Probe whether `dir`'s filesystem supports reflink (CoW clone).
+///
+/// Creates a throwaway file pair and attempts one clone. Callers doing
+/// bulk fan-out (link farm populate, batch projections) probe once and
+/// skip the per-file reflink attempt entirely on filesystems without it,
+/// instead of paying a failed ioctl per entry.
+pub fn probe_reflink_support(dir: &Path) -> bool {
+    let probe_src = dir.join(format!(".vrift_reflink_probe.{}", std::process::id()));
+    let probe_dst = probe_src.with_extension("clone");
+
+    if fs::write(&probe_src, b"probe").is_err() {
+        return false;
+    }
+    let supported = try_reflink(&probe_src, &probe_dst).is_ok();
+    let _ = fs::remove_file(&probe_src);
+    let _ = fs::remove_file(&probe_dst);
+    supported
+}
+
 /// Try to create a hard link from source to destination.
 ///
 /// # Errors
@@ -0,0 +1,292 @@
+//! Persistent Shared Existence Filter (RFC-0041 follow-up)
+//!
+//! Dedup ingest and `CasStore::exists()` used to pay a stat (or a full
+//! `read_dir` of the shard) through the 3-level fan-out for every candidate
+//! blob — millions of metadata syscalls on a warm re-ingest where nearly
+//! everything is already stored. This module maintains a persistent Bloom
+//! filter over all stored loose-blob hashes at `<cas_root>/exists.bloom`,
+//! shared between processes via a single `MAP_SHARED` mmap:
+//!
+//! - **definite miss** (bit clear): the blob is certainly absent, so ingest
+//!   skips the existence stat and links directly, and `exists()` skips the
+//!   fan-out probe entirely.
+//! - **maybe hit** (bits set): fall through to the normal filesystem check,
+//!   which acts as the verification step.
+//!
+//! Deletes never clear bits — the filter stays a safe superset of the store,
+//! so a stale positive only costs the stat we would have done anyway.
+//! [`CasStore::sweep`] rebuilds the filter after mass deletion to keep the
+//! false-positive rate low. Bit updates use atomic byte ORs directly on the
+//! mapping, so concurrent ingest processes never lose each other's adds.
+
+use std::fs::OpenOptions;
+use std::io;
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicU8, Ordering};
+use std::sync::{Arc, OnceLock};
+
+use dashmap::DashMap;
+use memmap2::MmapMut;
+
+use crate::Blake3Hash;
+
+/// Magic bytes identifying the filter file
+const BLOOM_FILE_MAGIC: [u8; 4] = *b"VRCB";
+
+/// Current on-disk format version
+const BLOOM_FILE_VERSION: u32 = 1;
+
+/// Header size; bits start here
+const BLOOM_HEADER_SIZE: usize = 64;
+
+/// Byte offset of the `valid` flag within the header
+const VALID_FLAG_OFFSET: usize = 8;
+
+/// Filter capacity: 8 MiB of bits (2^26). With 4 probes per hash this keeps
+/// the false-positive rate under 1% up to ~8M stored blobs.
+const BLOOM_BITS_LEN: usize = 8 * 1024 * 1024;
+
+/// Probes per hash. BLAKE3 output is uniform, so the four 8-byte words of
+/// the hash itself serve as independent bit indexes — no extra hashing.
+const BLOOM_PROBES: usize = 4;
+
+/// Filter filename under the CAS root
+const BLOOM_FILE_NAME: &str = "exists.bloom";
+
+/// Process-wide cache: one mapping per CAS root, shared by every CasStore
+/// and by the free-standing ingest functions in zero_copy_ingest.
+static OPEN_FILTERS: OnceLock<DashMap<PathBuf, Option<Arc<SharedBloom>>>> = OnceLock::new();
+
+/// Persistent Bloom filter over stored blob hashes, shared via mmap.
+pub struct SharedBloom {
+    map: MmapMut,
+}
+
+impl SharedBloom {
+    /// Open (or create) the filter for a CAS root, cached process-wide.
+    ///
+    /// Returns None if the filter cannot be opened (e.g. read-only CAS);
+    /// callers then simply fall back to filesystem checks.
+    pub fn for_cas_root(cas_root: &Path) -> Option<Arc<SharedBloom>> {
+        let filters = OPEN_FILTERS.get_or_init(DashMap::new);
+        filters
+            .entry(cas_root.to_path_buf())
+            .or_insert_with(|| match Self::open(cas_root) {
+                Ok(bloom) => Some(Arc::new(bloom)),
+                Err(e) => {
+                    tracing::debug!("CAS existence filter unavailable at {:?}: {}", cas_root, e);
+                    None
+                }
+            })
+            .clone()
+    }
+
+    /// Open the filter file, initializing and seeding it from the fan-out
+    /// if it is missing or malformed.
+    fn open(cas_root: &Path) -> io::Result<Self> {
+        std::fs::create_dir_all(cas_root)?;
+        let path = cas_root.join(BLOOM_FILE_NAME);
+        let file = OpenOptions::new()
+            .read(true)
+            .write(true)
+            .create(true)
+            .truncate(false)
+            .open(&path)?;
+
+        let total_len = (BLOOM_HEADER_SIZE + BLOOM_BITS_LEN) as u64;
+        let fresh = file.metadata()?.len() != total_len;
+        if fresh {
+            file.set_len(total_len)?;
+        }
+
+        // SAFETY: MAP_SHARED over a private-format file we own; all
+        // cross-process mutation goes through atomic byte ops below.
+        let mut map = unsafe { MmapMut::map_mut(&file)? };
+
+        let header_ok = map[0..4] == BLOOM_FILE_MAGIC
+            && u32::from_le_bytes(map[4..8].try_into().unwrap()) == BLOOM_FILE_VERSION;
+        if fresh || !header_ok {
+            map[0..4].copy_from_slice(&BLOOM_FILE_MAGIC);
+            map[4..8].copy_from_slice(&BLOOM_FILE_VERSION.to_le_bytes());
+            map[VALID_FLAG_OFFSET] = 0;
+            map[9..BLOOM_HEADER_SIZE].fill(0);
+            let bloom = Self { map };
+            // Seed from blobs already in the fan-out so negatives are
+            // trustworthy from the start. One-time cost per CAS.
+            bloom.rebuild(cas_root);
+            return Ok(bloom);
+        }
+
+        Ok(Self { map })
+    }
+
+    /// View a mapped byte as an atomic for lock-free cross-process updates.
+    #[inline]
+    fn atomic_byte(&self, offset: usize) -> &AtomicU8 {
+        // SAFETY: offset is bounds-checked by callers against the fixed
+        // layout; AtomicU8 has the same layout as u8.
+        unsafe { &*(self.map.as_ptr().add(offset) as *const AtomicU8) }
+    }
+
+    /// Bit indexes probed for a hash: its four little-endian u64 words.
+    #[inline]
+    fn probe_bits(hash: &Blake3Hash) -> [usize; BLOOM_PROBES] {
+        let mut bits = [0usize; BLOOM_PROBES];
+        for (i, chunk) in hash.chunks_exact(8).enumerate() {
+            bits[i] = (u64::from_le_bytes(chunk.try_into().unwrap()) as usize)
+                % (BLOOM_BITS_LEN * 8);
+        }
+        bits
+    }
+
+    /// Whether negatives can be trusted (filter is complete).
+    #[inline]
+    pub fn is_valid(&self) -> bool {
+        self.atomic_byte(VALID_FLAG_OFFSET).load(Ordering::Acquire) != 0
+    }
+
+    /// Record a stored blob hash.
+    #[inline]
+    pub fn add(&self, hash: &Blake3Hash) {
+        for bit in Self::probe_bits(hash) {
+            self.atomic_byte(BLOOM_HEADER_SIZE + bit / 8)
+                .fetch_or(1 << (bit % 8), Ordering::Relaxed);
+        }
+    }
+
+    /// Whether the blob *might* be stored. False means definitely absent
+    /// (when [`is_valid`](Self::is_valid) holds).
+    #[inline]
+    pub fn contains(&self, hash: &Blake3Hash) -> bool {
+        Self::probe_bits(hash).iter().all(|&bit| {
+            self.atomic_byte(BLOOM_HEADER_SIZE + bit / 8)
+                .load(Ordering::Relaxed)
+                & (1 << (bit % 8))
+                != 0
+        })
+    }
+
+    /// True if the blob is definitely absent: trusted filter says no.
+    #[inline]
+    pub fn definitely_absent(&self, hash: &Blake3Hash) -> bool {
+        self.is_valid() && !self.contains(hash)
+    }
+
+    /// Rebuild the filter from the blobs currently in the fan-out.
+    ///
+    /// Used after mass deletion (GC sweep) to re-tighten the superset, and
+    /// to seed a freshly created filter. The valid flag is dropped for the
+    /// duration so concurrent readers fall back to filesystem checks; a
+    /// store racing the walk still publishes its own bits via `add`, so the
+    /// finished filter stays complete.
+    pub fn rebuild(&self, cas_root: &Path) {
+        self.atomic_byte(VALID_FLAG_OFFSET).store(0, Ordering::Release);
+        for i in 0..BLOOM_BITS_LEN {
+            self.atomic_byte(BLOOM_HEADER_SIZE + i)
+                .store(0, Ordering::Relaxed);
+        }
+
+        let blake3_root = cas_root.join("blake3");
+        if let Ok(l1_dirs) = std::fs::read_dir(&blake3_root) {
+            for l1 in l1_dirs.flatten() {
+                let Ok(l2_dirs) = std::fs::read_dir(l1.path()) else {
+                    continue;
+                };
+                for l2 in l2_dirs.flatten() {
+                    let Ok(files) = std::fs::read_dir(l2.path()) else {
+                        continue;
+                    };
+                    for file in files.flatten() {
+                        let name = file.file_name();
+                        let name = name.to_string_lossy();
+                        if name.ends_with(".tmp") {
+                            continue;
+                        }
+                        if let Some(hash) = name
+                            .split('_')
+                            .next()
+                            .and_then(crate::CasStore::hex_to_hash)
+                        {
+                            self.add(&hash);
+                        }
+                    }
+                }
+            }
+        }
+
+        self.atomic_byte(VALID_FLAG_OFFSET).store(1, Ordering::Release);
+        let _ = self.map.flush_async();
+    }
+}
+
+/// Record a freshly stored blob in the CAS root's shared filter, if open.
+/// Convenience for the free-standing ingest paths.
+#[inline]
+pub(crate) fn note_stored(cas_root: &Path, hash: &Blake3Hash) {
+    if let Some(bloom) = SharedBloom::for_cas_root(cas_root) {
+        bloom.add(hash);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::CasStore;
+    use tempfile::TempDir;
+
+    #[test]
+    fn test_add_contains_round_trip() {
+        let temp = TempDir::new().unwrap();
+        let bloom = SharedBloom::open(temp.path()).unwrap();
+        assert!(bloom.is_valid());
+
+        let hash = CasStore::compute_hash(b"hello bloom");
+        assert!(!bloom.contains(&hash));
+        assert!(bloom.definitely_absent(&hash));
+
+        bloom.add(&hash);
+        assert!(bloom.contains(&hash));
+        assert!(!bloom.definitely_absent(&hash));
+    }
+
+    #[test]
+    fn test_persistence_across_opens() {
+        let temp = TempDir::new().unwrap();
+        let hash = CasStore::compute_hash(b"persistent bit");
+        {
+            let bloom = SharedBloom::open(temp.path()).unwrap();
+            bloom.add(&hash);
+        }
+        let reopened = SharedBloom::open(temp.path()).unwrap();
+        assert!(reopened.is_valid());
+        assert!(reopened.contains(&hash));
+    }
+
+    #[test]
+    fn test_fresh_filter_seeds_from_fanout() {
+        let temp = TempDir::new().unwrap();
+        let cas = CasStore::new(temp.path()).unwrap();
+        let hash = cas.store(b"pre-existing blob").unwrap();
+
+        // Remove the filter the store created, then reopen: the fresh
+        // filter must seed itself from the fan-out walk.
+        std::fs::remove_file(temp.path().join(BLOOM_FILE_NAME)).unwrap();
+        let bloom = SharedBloom::open(temp.path()).unwrap();
+        assert!(bloom.is_valid());
+        assert!(bloom.contains(&hash));
+    }
+
+    #[test]
+    fn test_rebuild_drops_deleted_hashes() {
+        let temp = TempDir::new().unwrap();
+        let cas = CasStore::new(temp.path()).unwrap();
+        let kept = cas.store(b"kept").unwrap();
+        let dropped = cas.store(b"dropped").unwrap();
+        cas.delete(&dropped).unwrap();
+
+        let bloom = SharedBloom::open(temp.path()).unwrap();
+        bloom.rebuild(temp.path());
+        assert!(bloom.contains(&kept));
+        assert!(!bloom.contains(&dropped));
+    }
+}
@@ -20,7 +20,7 @@ use std::sync::Arc;
 use std::thread::{self, JoinHandle};
 use std::time::{Duration, Instant, SystemTime};
 
-use crossbeam_channel::{bounded, RecvTimeoutError, Sender};
+use crossbeam_channel::{bounded, Receiver, RecvTimeoutError, Sender};
 use dashmap::DashSet;
 use notify::{RecursiveMode, Watcher};
 
@@ -337,7 +337,9 @@ impl WorkerPool {
                 break;
             }
 
-            hasher.update(&buf[..n]);
+            // Tree-hash chunks in parallel — chunk_size (4MB default) is well
+            // past the rayon break-even, and the result matches serial update()
+            hasher.update_rayon(&buf[..n]);
             writer.write_all(&buf[..n])?;
         }
 
@@ -358,6 +360,232 @@ impl WorkerPool {
         );
         self.cas_root.join("tmp").join(temp_name)
     }
+
+    /// Sentinel forwarded when a worker sees `ScanItem::Done`, so the
+    /// committer keeps draining until every worker has finished
+    fn done_sentinel() -> ProcessedFile {
+        ProcessedFile {
+            source_path: PathBuf::new(),
+            hash: [0u8; 32],
+            temp_path: PathBuf::new(),
+            size: 0,
+            mtime: SystemTime::UNIX_EPOCH,
+        }
+    }
+
+    /// Synchronous worker loop: one read/hash/write round-trip per item
+    #[cfg_attr(all(target_os = "linux", feature = "io_uring"), allow(dead_code))]
+    pub fn worker_loop(&self, rx: Receiver<ScanItem>, tx: Sender<ProcessedFile>) -> Result<u64> {
+        let mut processed = 0u64;
+        loop {
+            match rx.recv() {
+                Ok(ScanItem::Done) => {
+                    // Re-send Done for other workers
+                    let _ = tx.send_timeout(Self::done_sentinel(), Duration::from_millis(10));
+                    break;
+                }
+                Ok(item) => {
+                    match self.process(item) {
+                        Ok(Some(processed_file)) => {
+                            if tx.send(processed_file).is_err() {
+                                break;
+                            }
+                            processed += 1;
+                        }
+                        Ok(None) => { /* skip */ }
+                        Err(e) => {
+                            tracing::warn!("Worker error: {}", e);
+                        }
+                    }
+                }
+                Err(_) => break,
+            }
+        }
+        Ok(processed)
+    }
+}
+
+// ============================================================================
+// io_uring Worker Path (Linux, feature-gated)
+// ============================================================================
+
+/// Batched io_uring worker: reads, hashes and temp-writes flow through one
+/// ring per worker thread instead of a syscall round-trip per file.
+///
+/// Small files (< mmap_threshold) are gathered into batches and submitted
+/// concurrently — while one completion is being hashed, the ring keeps the
+/// other reads and writes in flight. Large files keep the streaming path,
+/// and the commit-side fsyncs stay batched in `BatchCommitter` (2 per batch).
+/// Memory permits are acquired for the whole batch up front so the runtime
+/// thread can never block on the semaphore while it owes completions.
+#[cfg(all(target_os = "linux", feature = "io_uring"))]
+impl WorkerPool {
+    /// Files per ring submission batch
+    const URING_BATCH: usize = 64;
+
+    pub fn worker_loop_uring(
+        &self,
+        rx: Receiver<ScanItem>,
+        tx: Sender<ProcessedFile>,
+    ) -> Result<u64> {
+        let mut processed = 0u64;
+        let mut done = false;
+
+        while !done {
+            // Gather a batch of small files; large files and watch events
+            // (unknown size) take the streaming path immediately
+            let mut batch: Vec<(PathBuf, u64)> = Vec::with_capacity(Self::URING_BATCH);
+            let mut batch_bytes = 0usize;
+
+            let first = match rx.recv() {
+                Ok(item) => item,
+                Err(_) => break,
+            };
+            let mut pending = Some(first);
+            loop {
+                match pending.take() {
+                    Some(ScanItem::Done) => {
+                        done = true;
+                        break;
+                    }
+                    Some(ScanItem::Path(path, size)) if size < self.config.mmap_threshold => {
+                        // Dedup here so the batch only carries real work
+                        if self.seen.insert(path.clone()) {
+                            batch_bytes += size as usize;
+                            batch.push((path, size));
+                        }
+                    }
+                    Some(item) => match self.process(item) {
+                        Ok(Some(pf)) => {
+                            if tx.send(pf).is_err() {
+                                return Ok(processed);
+                            }
+                            processed += 1;
+                        }
+                        Ok(None) => {}
+                        Err(e) => tracing::warn!("Worker error: {}", e),
+                    },
+                    None => unreachable!(),
+                }
+
+                // Keep the batch permit well under the memory budget so
+                // workers on other threads can still make progress
+                if batch.len() >= Self::URING_BATCH || batch_bytes >= self.config.memory_budget / 4
+                {
+                    break;
+                }
+                match rx.try_recv() {
+                    Ok(item) => pending = Some(item),
+                    Err(_) => break,
+                }
+            }
+
+            if !batch.is_empty() {
+                // One permit for the whole batch, before entering the runtime
+                let _permit = self.memory_sem.acquire(batch_bytes);
+                for result in self.process_batch_uring(batch) {
+                    match result {
+                        Ok(Some(pf)) => {
+                            if tx.send(pf).is_err() {
+                                return Ok(processed);
+                            }
+                            processed += 1;
+                        }
+                        Ok(None) => {}
+                        Err(e) => tracing::warn!("Worker error: {}", e),
+                    }
+                }
+            }
+
+            if done {
+                let _ = tx.send_timeout(Self::done_sentinel(), Duration::from_millis(10));
+            }
+        }
+        Ok(processed)
+    }
+
+    /// Submit one batch of small files through the ring: open + full read,
+    /// hash on completion, write the temp blob — all overlapped
+    fn process_batch_uring(
+        &self,
+        batch: Vec<(PathBuf, u64)>,
+    ) -> Vec<Result<Option<ProcessedFile>>> {
+        let cas_root = self.cas_root.clone();
+        let tmp_dir = cas_root.join("tmp");
+        let _ = fs::create_dir_all(&tmp_dir);
+
+        tokio_uring::start(async move {
+            let mut handles = Vec::with_capacity(batch.len());
+            for (path, size) in batch {
+                let tmp_dir = tmp_dir.clone();
+                handles.push(tokio_uring::spawn(async move {
+                    Self::ingest_one_uring(path, size, tmp_dir).await
+                }));
+            }
+
+            let mut results = Vec::with_capacity(handles.len());
+            for handle in handles {
+                results.push(handle.await.unwrap_or_else(|e| {
+                    Err(CasError::Io(std::io::Error::other(format!(
+                        "uring task join error: {:?}",
+                        e
+                    ))))
+                }));
+            }
+            results
+        })
+    }
+
+    async fn ingest_one_uring(
+        path: PathBuf,
+        size: u64,
+        tmp_dir: PathBuf,
+    ) -> Result<Option<ProcessedFile>> {
+        // Record mtime BEFORE reading (same torn-read guard as process())
+        let mtime_before = fs::metadata(&path)?.modified()?;
+
+        let file = tokio_uring::fs::File::open(&path).await?;
+        let buf = vec![0u8; size as usize];
+        let (res, buf) = file.read_exact_at(buf, 0).await;
+        res?;
+        let _ = file.close().await;
+
+        let hash = CasStore::compute_hash(&buf);
+
+        // Temp name: hash prefix + pid (one runtime thread per worker, but
+        // hashes already disambiguate within a batch)
+        let hex = hex::encode(hash);
+        let temp_path = tmp_dir.join(format!(
+            "{}.{}.{:?}.tmp",
+            &hex[..8],
+            std::process::id(),
+            std::thread::current().id()
+        ));
+
+        let out = tokio_uring::fs::File::create(&temp_path).await?;
+        let (res, _buf) = out.write_all_at(buf, 0).await;
+        res?;
+        // No per-file fsync — deferred to the batch commit, as in process()
+        let _ = out.close().await;
+
+        // Check mtime AFTER reading
+        let mtime_after = fs::metadata(&path)?.modified()?;
+        if mtime_before != mtime_after {
+            let _ = fs::remove_file(&temp_path);
+            return Err(CasError::Io(std::io::Error::other(format!(
+                "File modified during read: {}",
+                path.display()
+            ))));
+        }
+
+        Ok(Some(ProcessedFile {
+            source_path: path,
+            hash,
+            temp_path,
+            size,
+            mtime: mtime_before,
+        }))
+    }
 }
 
 // ============================================================================
@@ -416,6 +644,7 @@ impl BatchCommitter {
 
             // Skip if already exists (dedup)
             if final_path.exists() {
+                crate::shared_bloom::note_stored(&self.cas_root, &item.hash);
                 let _ = fs::remove_file(&item.temp_path);
                 deduplicated += 1;
                 continue;
@@ -427,6 +656,7 @@ impl BatchCommitter {
             }
 
             fs::rename(&item.temp_path, &final_path)?;
+            crate::shared_bloom::note_stored(&self.cas_root, &item.hash);
         }
 
         // Step 3: Directory fsync for renames (blake3 directory)
@@ -494,41 +724,10 @@ impl IngestPipeline {
                 let tx = commit_tx.clone();
 
                 thread::spawn(move || {
-                    let mut processed = 0u64;
-                    loop {
-                        match rx.recv() {
-                            Ok(ScanItem::Done) => {
-                                // Re-send Done for other workers
-                                let _ = tx.send_timeout(
-                                    ProcessedFile {
-                                        source_path: PathBuf::new(),
-                                        hash: [0u8; 32],
-                                        temp_path: PathBuf::new(),
-                                        size: 0,
-                                        mtime: SystemTime::UNIX_EPOCH,
-                                    },
-                                    Duration::from_millis(10),
-                                );
-                                break;
-                            }
-                            Ok(item) => {
-                                match pool.process(item) {
-                                    Ok(Some(processed_file)) => {
-                                        if tx.send(processed_file).is_err() {
-                                            break;
-                                        }
-                                        processed += 1;
-                                    }
-                                    Ok(None) => { /* skip */ }
-                                    Err(e) => {
-                                        tracing::warn!("Worker error: {}", e);
-                                    }
-                                }
-                            }
-                            Err(_) => break,
-                        }
-                    }
-                    Ok(processed)
+                    #[cfg(all(target_os = "linux", feature = "io_uring"))]
+                    return pool.worker_loop_uring(rx, tx);
+                    #[cfg(not(all(target_os = "linux", feature = "io_uring")))]
+                    pool.worker_loop(rx, tx)
                 })
             })
             .collect();
@@ -66,6 +66,36 @@ fn link_or_clone_or_copy(source: &Path, target: &Path) -> io::Result<bool> {
     Ok(true)
 }
 
+/// [`link_or_clone_or_copy`] fronted by the shared existence filter.
+///
+/// A trusted filter negative means the blob is definitely absent, so the
+/// `target.exists()` stat through the fan-out is skipped and the link goes
+/// straight through (an EEXIST race with another ingester still degrades to
+/// dedup). Anything else falls back to the stat-first path. The hash is
+/// recorded in the filter either way so later probes for it are filter hits.
+fn link_with_exists_filter(
+    source: &Path,
+    target: &Path,
+    cas_root: &Path,
+    hash: &Blake3Hash,
+) -> io::Result<bool> {
+    let bloom = crate::shared_bloom::SharedBloom::for_cas_root(cas_root);
+    let was_new = if bloom.as_ref().is_some_and(|b| b.definitely_absent(hash)) {
+        match crate::link_strategy::get_strategy().link_file(source, target) {
+            Ok(()) => true,
+            // Another ingester won the race — same content, dedup succeeded
+            Err(e) if e.kind() == io::ErrorKind::AlreadyExists => false,
+            Err(e) => return Err(e),
+        }
+    } else {
+        link_or_clone_or_copy(source, target)?
+    };
+    if let Some(b) = bloom {
+        b.add(hash);
+    }
+    Ok(was_new)
+}
+
 // ============================================================================
 // Tier-1 Immutable Flag (RFC-0039 §5.1.1)
 // ============================================================================
@@ -177,8 +207,9 @@ pub fn ingest_solid_tier1(source: &Path, cas_root: &Path) -> Result<IngestResult
         fs::create_dir_all(parent)?;
     }
 
-    // Tiered link: hard_link → clonefile → copy (RFC-0040)
-    let was_new = link_or_clone_or_copy(source, &cas_target)?;
+    // Tiered link: hard_link → clonefile → copy (RFC-0040),
+    // stat-free when the existence filter reports a definite miss
+    let was_new = link_with_exists_filter(source, &cas_target, cas_root, &hash)?;
 
     // Drop the lock guard before modifying source
     drop(locked_file);
@@ -245,8 +276,9 @@ pub fn ingest_solid_tier1_dedup(
             fs::create_dir_all(parent)?;
         }
 
-        // Tiered link: hard_link → clonefile → copy (RFC-0040)
-        link_or_clone_or_copy(source, &cas_target)?;
+        // Tiered link: hard_link → clonefile → copy (RFC-0040),
+        // stat-free when the existence filter reports a definite miss
+        link_with_exists_filter(source, &cas_target, cas_root, &hash)?;
     }
 
     // Lock (if acquired) is automatically dropped here
@@ -294,8 +326,9 @@ pub fn ingest_solid_tier2(source: &Path, cas_root: &Path) -> Result<IngestResult
         fs::create_dir_all(parent)?;
     }
 
-    // Tiered link: hard_link → clonefile → copy (RFC-0040)
-    let was_new = link_or_clone_or_copy(source, &cas_target)?;
+    // Tiered link: hard_link → clonefile → copy (RFC-0040),
+    // stat-free when the existence filter reports a definite miss
+    let was_new = link_with_exists_filter(source, &cas_target, cas_root, &hash)?;
 
     // Iron Law: always enforce CAS invariant — existing blobs may have corrupted perms
     let _ = crate::protection::enforce_cas_invariant(&cas_target);
@@ -450,8 +483,9 @@ pub fn ingest_solid_tier2_dedup(
         fs::create_dir_all(parent)?;
     }
 
-    // Tiered link: hard_link → clonefile → copy (RFC-0040)
-    let was_new = link_or_clone_or_copy(source, &cas_target)?;
+    // Tiered link: hard_link → clonefile → copy (RFC-0040),
+    // stat-free when the existence filter reports a definite miss
+    let was_new = link_with_exists_filter(source, &cas_target, cas_root, &hash)?;
 
     // Iron Law: always enforce CAS invariant — existing blobs may have corrupted perms
     let _ = crate::protection::enforce_cas_invariant(&cas_target);
@@ -494,6 +528,7 @@ pub fn ingest_phantom(source: &Path, cas_root: &Path) -> Result<IngestResult> {
     // RFC-0039 Audit: If target already exists and is immutable, rename will fail with EPERM.
     // We check existence first to handle duplicate ingest safely.
     if cas_target.exists() {
+        crate::shared_bloom::note_stored(cas_root, &hash);
         let _ = fs::remove_file(source); // Clean up source since it's already in CAS
         return Ok(IngestResult {
             source_path: source.to_owned(),
@@ -535,6 +570,218 @@ pub fn ingest_phantom(source: &Path, cas_root: &Path) -> Result<IngestResult> {
         Err(e) => return Err(e.into()),
     }
 
+    crate::shared_bloom::note_stored(cas_root, &hash);
+
+    Ok(IngestResult {
+        source_path: source.to_owned(),
+        hash,
+        size,
+        was_new: true,
+        skipped_by_cache: false,
+        mtime: mtime_nsec_from_metadata(&metadata),
+        mode: metadata.mode(),
+    })
+}
+
+// ============================================================================
+// Content-Defined Chunking (CDC) for Large Mutable Artifacts
+// ============================================================================
+//
+// Incremental builds rewrite multi-GB binaries where <5% of bytes change.
+// Whole-file blobs make CAS growth track full artifact size per build; CDC
+// splits large files at content-defined boundaries (gear rolling hash) so
+// unchanged regions dedup against the previous build's chunks.
+//
+// Layout: chunks are ordinary loose blobs; the file itself is recorded as a
+// chunk-index blob named `wholehash_rawsize.cdc` (filename keeps the WHOLE
+// file hash and ORIGINAL size, same convention as the `.zst` cold tier, so
+// lookups and the O(1) size check are unchanged). `CasStore::get()` and
+// `get_mmap()` reconstruct transparently; the link farm rehydrates to a raw
+// blob before projecting.
+
+/// Extension for chunk-index blobs in the fan-out
+pub const CDC_EXT: &str = "cdc";
+
+/// Minimum chunk size — boundaries are not considered before this offset
+pub const CDC_MIN_CHUNK: usize = 512 * 1024;
+/// Average chunk size target: boundary when `hash & CDC_AVG_MASK == 0`
+pub const CDC_AVG_MASK: u64 = (1 << 20) - 1; // ~1MB average
+/// Hard cap — a cut is forced here so pathological data can't runaway
+pub const CDC_MAX_CHUNK: usize = 4 * 1024 * 1024;
+
+/// Files below this are not worth the index indirection; callers should
+/// route them through the whole-blob ingest paths.
+pub const CDC_SIZE_THRESHOLD: u64 = 64 * 1024 * 1024;
+
+/// Magic + version prefix of the chunk-index format
+const CDC_INDEX_MAGIC: &[u8; 8] = b"VRCDC\0\0\x01";
+
+/// Gear table for the rolling hash, derived deterministically (splitmix64)
+/// so chunk boundaries are stable across builds and machines.
+static GEAR: std::sync::LazyLock<[u64; 256]> = std::sync::LazyLock::new(|| {
+    let mut state: u64 = 0x9E37_79B9_7F4A_7C15;
+    let mut table = [0u64; 256];
+    for slot in table.iter_mut() {
+        state = state.wrapping_add(0x9E37_79B9_7F4A_7C15);
+        let mut z = state;
+        z = (z ^ (z >> 30)).wrapping_mul(0xBF58_476D_1CE4_E5B9);
+        z = (z ^ (z >> 27)).wrapping_mul(0x94D0_49BB_1331_11EB);
+        *slot = z ^ (z >> 31);
+    }
+    table
+});
+
+/// One chunk of a CDC-ingested file, in file order.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ChunkRef {
+    pub hash: Blake3Hash,
+    pub size: u64,
+}
+
+/// Split `data` into content-defined chunks, returning (offset, len) pairs.
+///
+/// Gear CDC: boundary where the rolling hash masks to zero, clamped to
+/// [CDC_MIN_CHUNK, CDC_MAX_CHUNK]. An insertion only shifts boundaries
+/// until the next cut point, so downstream chunks re-align and dedup.
+pub fn chunk_boundaries(data: &[u8]) -> Vec<(usize, usize)> {
+    let gear = &*GEAR;
+    let mut chunks = Vec::new();
+    let mut start = 0;
+
+    while start < data.len() {
+        let remaining = data.len() - start;
+        if remaining <= CDC_MIN_CHUNK {
+            chunks.push((start, remaining));
+            break;
+        }
+
+        let max_len = remaining.min(CDC_MAX_CHUNK);
+        let mut hash: u64 = 0;
+        let mut cut = max_len;
+        for (i, &byte) in data[start..start + max_len].iter().enumerate() {
+            hash = (hash << 1).wrapping_add(gear[byte as usize]);
+            if i >= CDC_MIN_CHUNK && hash & CDC_AVG_MASK == 0 {
+                cut = i + 1;
+                break;
+            }
+        }
+
+        chunks.push((start, cut));
+        start += cut;
+    }
+
+    chunks
+}
+
+/// Serialize a chunk list to the index-blob format.
+pub fn encode_chunk_index(chunks: &[ChunkRef]) -> Vec<u8> {
+    let mut out = Vec::with_capacity(CDC_INDEX_MAGIC.len() + 8 + chunks.len() * 40);
+    out.extend_from_slice(CDC_INDEX_MAGIC);
+    out.extend_from_slice(&(chunks.len() as u64).to_le_bytes());
+    for chunk in chunks {
+        out.extend_from_slice(&chunk.hash);
+        out.extend_from_slice(&chunk.size.to_le_bytes());
+    }
+    out
+}
+
+/// Parse an index blob back into its chunk list.
+pub fn decode_chunk_index(data: &[u8]) -> Result<Vec<ChunkRef>> {
+    let malformed = |what: &str| CasError::Io(io::Error::other(format!("CDC index: {}", what)));
+
+    if data.len() < CDC_INDEX_MAGIC.len() + 8 || &data[..CDC_INDEX_MAGIC.len()] != CDC_INDEX_MAGIC {
+        return Err(malformed("bad magic"));
+    }
+    let count = u64::from_le_bytes(data[8..16].try_into().unwrap()) as usize;
+    let body = &data[16..];
+    if body.len() != count * 40 {
+        return Err(malformed("truncated entry table"));
+    }
+
+    let mut chunks = Vec::with_capacity(count);
+    for entry in body.chunks_exact(40) {
+        chunks.push(ChunkRef {
+            hash: entry[..32].try_into().unwrap(),
+            size: u64::from_le_bytes(entry[32..40].try_into().unwrap()),
+        });
+    }
+    Ok(chunks)
+}
+
+/// Ingest a large mutable artifact via content-defined chunking.
+///
+/// Tier-2 semantics (original stays in place). Chunks are stored as loose
+/// blobs — unchanged regions dedup against the previous build — and a
+/// `wholehash_rawsize.cdc` index blob records the reconstruction order.
+/// Reads resolve through `CasStore::get()`/`get_mmap()` transparently.
+pub fn ingest_cdc(source: &Path, cas_root: &Path) -> Result<IngestResult> {
+    let file = File::open(source)?;
+    let metadata = file.metadata()?;
+    let size = metadata.len();
+
+    let locked_file = lock_with_retry(file, FlockArg::LockShared)?;
+    let cas = crate::CasStore::new(cas_root)?;
+
+    // Empty files have no chunks — route through the whole-blob path
+    if size == 0 {
+        drop(locked_file);
+        return ingest_solid_tier2(source, cas_root);
+    }
+
+    // SAFETY: mmap requires a valid file descriptor; flock held for the scan
+    let mmap = unsafe { memmap2::Mmap::map(&*locked_file)? };
+    let hash = crate::CasStore::compute_hash(&mmap);
+
+    // Dedup: identical artifact already in CAS (chunked or whole)
+    if cas.find_blob_path(&hash).is_some() {
+        return Ok(IngestResult {
+            source_path: source.to_owned(),
+            hash,
+            size,
+            was_new: false,
+            skipped_by_cache: false,
+            mtime: mtime_nsec_from_metadata(&metadata),
+            mode: metadata.mode(),
+        });
+    }
+
+    // Store chunks — cas.store() dedups per chunk, so only the changed
+    // regions of an incrementally rebuilt binary cost new blobs
+    let mut chunks = Vec::new();
+    for (offset, len) in chunk_boundaries(&mmap) {
+        let chunk_hash = cas.store(&mmap[offset..offset + len])?;
+        chunks.push(ChunkRef {
+            hash: chunk_hash,
+            size: len as u64,
+        });
+    }
+    drop(mmap);
+    drop(locked_file);
+
+    // Write the index blob atomically (temp + rename, same as store())
+    let index_path = cas.blob_path_with_metadata(&hash, size, CDC_EXT);
+    if let Some(parent) = index_path.parent() {
+        fs::create_dir_all(parent)?;
+    }
+    let temp_path = index_path.with_file_name(format!(
+        "{}.{}.tmp",
+        index_path.file_name().unwrap().to_string_lossy(),
+        std::process::id()
+    ));
+    {
+        use std::io::Write;
+        let mut f = File::create(&temp_path)?;
+        f.write_all(&encode_chunk_index(&chunks))?;
+        f.sync_all()?;
+    }
+    if let Err(e) = fs::rename(&temp_path, &index_path) {
+        let _ = fs::remove_file(&temp_path);
+        // Lost a race to another ingester of the same content — that's dedup
+        if !index_path.exists() {
+            return Err(e.into());
+        }
+    }
+
     Ok(IngestResult {
         source_path: source.to_owned(),
         hash,
@@ -651,10 +898,11 @@ fn tiered_hash(file: &File, size: u64) -> Result<Blake3Hash> {
         (&*file).read_exact(&mut buf)?;
         Ok(*blake3::hash(&buf).as_bytes())
     } else {
-        // Medium/Large file: mmap for zero-copy
+        // Medium/Large file: mmap for zero-copy.
+        // compute_hash() goes multi-threaded past PARALLEL_HASH_THRESHOLD.
         // SAFETY: mmap requires a valid file descriptor
         let mmap = unsafe { memmap2::Mmap::map(file)? };
-        Ok(*blake3::hash(&mmap).as_bytes())
+        Ok(crate::CasStore::compute_hash(&mmap))
     }
 }
 
@@ -722,6 +970,94 @@ mod tests {
         assert_eq!(fs::read(&cas_file).unwrap(), original_content);
     }
 
+    /// Deterministic pseudo-random payload (xorshift) so gear boundaries land
+    fn cdc_payload(len: usize, seed: u64) -> Vec<u8> {
+        let mut state = seed;
+        let mut data = Vec::with_capacity(len);
+        while data.len() < len {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            data.extend_from_slice(&state.to_le_bytes());
+        }
+        data.truncate(len);
+        data
+    }
+
+    #[test]
+    fn test_cdc_boundaries_cover_input() {
+        let data = cdc_payload(6 * 1024 * 1024, 42);
+        let chunks = chunk_boundaries(&data);
+
+        assert!(chunks.len() > 1, "6MB should split into multiple chunks");
+        let mut expected_offset = 0;
+        for &(offset, len) in &chunks {
+            assert_eq!(offset, expected_offset);
+            assert!(len <= CDC_MAX_CHUNK);
+            expected_offset += len;
+        }
+        assert_eq!(expected_offset, data.len());
+    }
+
+    #[test]
+    fn test_cdc_index_roundtrip() {
+        let chunks = vec![
+            ChunkRef {
+                hash: [0x11; 32],
+                size: 1234,
+            },
+            ChunkRef {
+                hash: [0x22; 32],
+                size: 5678,
+            },
+        ];
+        let encoded = encode_chunk_index(&chunks);
+        assert_eq!(decode_chunk_index(&encoded).unwrap(), chunks);
+        assert!(decode_chunk_index(b"not an index").is_err());
+    }
+
+    #[test]
+    fn test_cdc_ingest_reconstruct_and_dedup() {
+        let source_dir = TempDir::new().unwrap();
+        let cas_dir = TempDir::new().unwrap();
+        let cas = crate::CasStore::new(cas_dir.path()).unwrap();
+
+        let mut data = cdc_payload(6 * 1024 * 1024, 7);
+        let artifact = source_dir.path().join("libapp.so");
+        fs::write(&artifact, &data).unwrap();
+
+        let first = ingest_cdc(&artifact, cas_dir.path()).unwrap();
+        assert!(first.was_new);
+        let baseline_blobs = cas.stats().unwrap().blob_count;
+        assert!(baseline_blobs > 2, "chunks + index expected");
+
+        // get() reconstructs and verifies the whole-file hash
+        assert_eq!(cas.get(&first.hash).unwrap(), data);
+        assert_eq!(&cas.get_mmap(&first.hash).unwrap()[..], &data[..]);
+
+        // Incremental rebuild: flip a small region in the middle —
+        // only the chunks covering it (plus a new index) should be new
+        let mid = data.len() / 2;
+        data[mid..mid + 64].fill(0xEE);
+        fs::write(&artifact, &data).unwrap();
+
+        let second = ingest_cdc(&artifact, cas_dir.path()).unwrap();
+        assert!(second.was_new);
+        assert_ne!(second.hash, first.hash);
+        let new_blobs = cas.stats().unwrap().blob_count - baseline_blobs;
+        assert!(
+            new_blobs <= 3,
+            "expected ~1 changed chunk + index, got {} new blobs",
+            new_blobs
+        );
+        assert_eq!(cas.get(&second.hash).unwrap(), data);
+
+        // Projection rehydrates the index into a raw blob
+        let target = source_dir.path().join("projected.so");
+        cas.link_mutable(&second.hash, &target).unwrap();
+        assert_eq!(fs::read(&target).unwrap(), data);
+    }
+
     #[test]
     fn test_cached_ingest_skip() {
         let (_source_dir, cas_dir, test_file) = setup();
@@ -8,7 +8,8 @@ use std::collections::HashSet;
 use std::io::{self, Write};
 use std::path::{Path, PathBuf};
 use std::time::Instant;
-use vrift_cas::CasStore;
+use vrift_cas::{Blake3Hash, CasStore};
+use vrift_ipc::{BloomFilter, BLOOM_SIZE};
 use vrift_manifest::Manifest;
 
 use crate::registry::ManifestRegistry;
@@ -30,6 +31,14 @@ pub struct GcArgs {
     /// Skip confirmation prompt (for scripts and CI)
     #[arg(long, short = 'y', default_value = "false")]
     yes: bool,
+
+    /// Demote cold blobs to the zstd compression tier after the sweep
+    #[arg(long)]
+    compress_cold: bool,
+
+    /// Minimum blob age (days) before cold-tier demotion
+    #[arg(long, default_value = "7")]
+    compress_age_days: u64,
 }
 
 pub async fn run(cas_root: &Path, args: GcArgs) -> Result<()> {
@@ -46,47 +55,52 @@ pub async fn run(cas_root: &Path, args: GcArgs) -> Result<()> {
     // Verify all manifests to detect stale ones
     let (active_count, stale_count) = registry.verify_all();
 
-    // Collect all referenced blob hashes
-    let keep_set: HashSet<_> = if let Some(ref manifest_path) = args.manifest {
-        println!();
-        println!("  [Legacy Mode] Using single manifest: {:?}", manifest_path);
-        let manifest = Manifest::load(manifest_path).context("Failed to parse manifest")?;
-        manifest
-            .iter()
-            .map(|(_, entry)| entry.content_hash)
-            .collect()
-    } else {
-        println!();
-        println!("  Registry Status:");
-        println!(
-            "    📁 Registered manifests: {} ({} active, {} stale)",
-            registry.manifests.len(),
-            active_count,
-            stale_count
-        );
-
-        if args.prune_stale && stale_count > 0 {
-            let pruned = registry.prune_stale();
-            registry.save()?;
-            println!("    🗑️  Pruned {} stale manifest entries", pruned);
-        }
+    // Mark phase: collect the live set. Prefer the blooms vDird maintains
+    // incrementally (no manifest walk at all); fall back to the parallel
+    // registry walk when any project lacks a fresh bloom.
+    let (bloom, keep_set): (BloomFilter, Option<HashSet<_>>) =
+        if let Some(ref manifest_path) = args.manifest {
+            println!();
+            println!("  [Legacy Mode] Using single manifest: {:?}", manifest_path);
+            let manifest = Manifest::load(manifest_path).context("Failed to parse manifest")?;
+            let keep: HashSet<_> = manifest
+                .iter()
+                .map(|(_, entry)| entry.content_hash)
+                .collect();
+            (build_bloom(&keep), Some(keep))
+        } else {
+            println!();
+            println!("  Registry Status:");
+            println!(
+                "    📁 Registered manifests: {} ({} active, {} stale)",
+                registry.manifests.len(),
+                active_count,
+                stale_count
+            );
 
-        registry
-            .get_all_blob_hashes()
-            .context("Failed to collect blob hashes from manifests")?
-    };
+            if args.prune_stale && stale_count > 0 {
+                let pruned = registry.prune_stale();
+                registry.save()?;
+                println!("    🗑️  Pruned {} stale manifest entries", pruned);
+            }
 
-    println!();
-    println!(
-        "  ✅ Referenced blobs: {}",
-        format_number(keep_set.len() as u64)
-    );
+            if let Some(live) = load_live_set_blooms(&registry) {
+                println!("    ⚡ Using daemon-maintained live-set blooms (incremental mark)");
+                (live, None)
+            } else {
+                let keep = registry
+                    .get_all_blob_hashes()
+                    .context("Failed to collect blob hashes from manifests")?;
+                (build_bloom(&keep), Some(keep))
+            }
+        };
 
-    // Build Bloom Filter from keep_set
-    use vrift_ipc::{BloomFilter, BLOOM_SIZE};
-    let mut bloom = BloomFilter::new(BLOOM_SIZE);
-    for hash in &keep_set {
-        bloom.add(&CasStore::hash_to_hex(hash));
+    if let Some(ref keep) = keep_set {
+        println!();
+        println!(
+            "  ✅ Referenced blobs: {}",
+            format_number(keep.len() as u64)
+        );
     }
 
     if args.delete {
@@ -148,7 +162,13 @@ pub async fn run(cas_root: &Path, args: GcArgs) -> Result<()> {
 
         if let Ok(iter) = cas.iter() {
             for hash in iter.flatten() {
-                if !keep_set.contains(&hash) {
+                // Exact set when we walked the manifests; bloom (same test
+                // the daemon sweep applies) on the incremental path
+                let live = match keep_set {
+                    Some(ref keep) => keep.contains(&hash),
+                    None => bloom.contains(&CasStore::hash_to_hex(&hash)),
+                };
+                if !live {
                     orphan_count += 1;
                     if let Some(p) = cas.blob_path_for_hash(&hash) {
                         if let Ok(meta) = std::fs::metadata(p) {
@@ -173,12 +193,86 @@ pub async fn run(cas_root: &Path, args: GcArgs) -> Result<()> {
         println!("     👉 Run with --delete to trigger daemon sweep.");
     }
 
+    // Cold-tier demotion: surviving blobs untouched for N days get
+    // re-encoded as zstd in place (rehydrated transparently when projected)
+    if args.compress_cold {
+        println!("  ❄️  Compressing cold blobs (>{} days old)...", args.compress_age_days);
+        let cas = CasStore::new(cas_root)?;
+        let min_age = std::time::Duration::from_secs(args.compress_age_days * 24 * 3600);
+        let (count, saved) =
+            cas.compress_cold_blobs(min_age, vrift_cas::compression::DEFAULT_ZSTD_LEVEL)?;
+        if count > 0 {
+            println!(
+                "   ✅ {} blobs compressed, {} saved",
+                format_number(count),
+                format_bytes(saved)
+            );
+        } else {
+            println!("   ✅ Nothing to compress.");
+        }
+    }
+
     // Save registry
     registry.save()?;
     println!();
     Ok(())
 }
 
+/// Build the sweep bloom from an exact keep set
+fn build_bloom(keep_set: &HashSet<Blake3Hash>) -> BloomFilter {
+    let mut bloom = BloomFilter::new(BLOOM_SIZE);
+    for hash in keep_set {
+        bloom.add(&CasStore::hash_to_hex(hash));
+    }
+    bloom
+}
+
+/// OR together the live-set blooms vDird persists beside each project
+/// manifest (`.vrift/live_set.bloom`).
+///
+/// Returns None unless EVERY active manifest is an LMDB project directory
+/// with a bloom at least as new as the manifest data — anything less and
+/// the live set could be incomplete, so the caller falls back to walking
+/// the manifests. (A stale-but-superset bloom is fine; a bloom missing
+/// recent ingests is not.)
+fn load_live_set_blooms(registry: &ManifestRegistry) -> Option<BloomFilter> {
+    let active = registry.active_manifests();
+    if active.is_empty() {
+        return None;
+    }
+
+    let mut acc = BloomFilter::new(BLOOM_SIZE);
+    for (_, entry) in active {
+        if !entry.source_path.is_dir() {
+            return None; // Legacy file manifests have no daemon bloom
+        }
+        let vrift_dir = entry.source_path.parent()?;
+        if vrift_dir.file_name()? != ".vrift" {
+            return None;
+        }
+        let bloom_path = vrift_dir.join("live_set.bloom");
+        let bloom_mtime = std::fs::metadata(&bloom_path)
+            .and_then(|m| m.modified())
+            .ok()?;
+        let manifest_mtime = std::fs::metadata(entry.source_path.join("data.mdb"))
+            .or_else(|_| std::fs::metadata(&entry.source_path))
+            .and_then(|m| m.modified())
+            .ok()?;
+        if bloom_mtime < manifest_mtime {
+            return None; // Bloom predates the last manifest write
+        }
+
+        let bloom = vrift_vdird::live_set::load(&bloom_path)?;
+        if bloom.bits.len() != acc.bits.len() {
+            return None;
+        }
+        for (a, b) in acc.bits.iter_mut().zip(bloom.bits.iter()) {
+            *a |= b;
+        }
+    }
+    Some(acc)
+}
+
 /// Format bytes in human-readable form
 fn format_bytes(bytes: u64) -> String {
     const KB: u64 = 1024;
@@ -184,11 +184,55 @@ fn setup_mounts(
         .with_context(|| format!("Failed to open CAS: {}", cas_root.display()))?;
 
     // 2. Populate LowerDir (Link Farm)
-    println!("   [Isolation] Populating LowerDir...");
+    //
+    // VRIFT_LAZY_FARM=1: only the directory skeleton is created up front;
+    // the AccessProfile working set is linked eagerly and everything else
+    // materializes from a background thread while the build runs. Most
+    // entries are never opened by a given target, so eager population of
+    // the full manifest is almost pure startup cost.
     let link_farm = LinkFarm::new(cas);
-    link_farm
-        .populate(&manifests, &lower_dir)
-        .context("Failed to populate Link Farm")?;
+    let lazy_mode = std::env::var("VRIFT_LAZY_FARM").is_ok_and(|v| v == "1");
+    if lazy_mode {
+        println!("   [Isolation] Populating LowerDir skeleton (lazy mode)...");
+        let lazy = link_farm
+            .populate_lazy(&manifests, &lower_dir)
+            .context("Failed to populate Link Farm skeleton")?;
+
+        // Profile-guided warm-up: link the recorded working set first
+        let profile_path = std::env::current_dir()
+            .unwrap_or_default()
+            .join(".vrift/access.profile");
+        if let Ok(profile) = vrift_pack::AccessProfile::load(&profile_path) {
+            let hot: std::collections::HashSet<_> = profile.access_order.into_iter().collect();
+            let warmed = lazy
+                .materialize_where(|entry| hot.contains(&entry.content_hash))
+                .context("Failed to materialize profile working set")?;
+            println!(
+                "   [Isolation] Warmed {} profiled entries, {} deferred",
+                warmed,
+                lazy.pending_count()
+            );
+        } else {
+            println!(
+                "   [Isolation] No access profile, {} entries deferred",
+                lazy.pending_count()
+            );
+        }
+
+        // Finish the farm in the background; the build starts immediately
+        let lazy = std::sync::Arc::new(lazy);
+        let bg = std::sync::Arc::clone(&lazy);
+        std::thread::spawn(move || {
+            if let Err(e) = bg.materialize_all() {
+                tracing::warn!("Background link farm materialization failed: {}", e);
+            }
+        });
+    } else {
+        println!("   [Isolation] Populating LowerDir...");
+        link_farm
+            .populate_parallel(&manifests, &lower_dir)
+            .context("Failed to populate Link Farm")?;
+    }
 
     // 3. Mount OverlayFS
     println!("   [Isolation] Mounting OverlayFS...");
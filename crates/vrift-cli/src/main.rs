@@ -26,6 +26,7 @@ mod preflight;
 pub mod registry;
 #[allow(dead_code)]
 mod security_filter;
+mod stats;
 
 use vrift_cas::CasStore;
 use vrift_manifest::lmdb::LmdbManifest;
@@ -240,6 +241,39 @@ enum Commands {
         directory: Option<PathBuf>,
     },
 
+    /// Prefetch the blobs a recorded build touched (profile-guided warm-up)
+    ///
+    /// Builds an access-ordered pack from a saved profile and queues a
+    /// sequential readahead so a cold-cache build skips the random reads
+    Warm {
+        /// Saved access profile (see vrift_pack::AccessProfile)
+        #[arg(short, long, default_value = ".vrift/access.profile")]
+        profile: PathBuf,
+
+        /// Warm pack output path
+        #[arg(short, long, default_value = ".vrift/warm.pack")]
+        output: PathBuf,
+
+        /// Reuse an existing warm pack instead of rebuilding it
+        #[arg(long)]
+        no_rebuild: bool,
+    },
+
+    /// Show live hot-path performance counters from running shim processes
+    Stats {
+        /// Project directory (default: current directory)
+        #[arg(value_name = "DIR")]
+        directory: Option<PathBuf>,
+
+        /// Sampling interval in seconds
+        #[arg(short, long, default_value = "1.0")]
+        interval: f64,
+
+        /// Keep sampling until interrupted
+        #[arg(short, long)]
+        watch: bool,
+    },
+
     /// Run diagnostic checks on the Velo Rift environment
     Doctor {
         /// Project directory (default: current directory)
@@ -582,6 +616,19 @@ async fn async_main(
             let dir = directory.unwrap_or_else(|| std::env::current_dir().unwrap());
             cmd_sync(&dir).await
         }
+        Commands::Warm {
+            profile,
+            output,
+            no_rebuild,
+        } => cmd_warm(&cas_root, &profile, &output, no_rebuild),
+        Commands::Stats {
+            directory,
+            interval,
+            watch,
+        } => {
+            let dir = directory.unwrap_or_else(|| std::env::current_dir().unwrap());
+            stats::cmd_stats(&dir, interval, watch)
+        }
         Commands::Doctor { directory } => {
             let dir = directory.unwrap_or_else(|| std::env::current_dir().unwrap());
             doctor::cmd_doctor(&dir)
@@ -1002,6 +1049,50 @@ async fn cmd_sync(directory: &Path) -> Result<()> {
     Ok(())
 }
 
+/// Profile-guided warm-up: pack the last build's working set in access
+/// order and queue a sequential readahead before the build starts
+fn cmd_warm(cas_root: &Path, profile: &Path, output: &Path, no_rebuild: bool) -> Result<()> {
+    use vrift_pack::{build_warm_pack, readahead, AccessProfile};
+
+    if no_rebuild && output.exists() {
+        let len = readahead(output)
+            .with_context(|| format!("Failed to readahead {}", output.display()))?;
+        println!("Warm: readahead queued for {} ({})", output.display(), format_bytes(len));
+        return Ok(());
+    }
+
+    if !profile.exists() {
+        anyhow::bail!(
+            "Access profile not found: {}. Record one during a build first.",
+            profile.display()
+        );
+    }
+
+    let profile_data = AccessProfile::load(profile)
+        .map_err(|e| anyhow::anyhow!("Failed to load profile {}: {}", profile.display(), e))?;
+    if profile_data.access_order.is_empty() {
+        anyhow::bail!("Access profile is empty: {}", profile.display());
+    }
+
+    let mut cas = vrift_cas::CasStore::new(cas_root)?;
+    // Packed blobs count too — the profile may reference compacted blobs
+    let _ = vrift_pack::attach_pack_tier(&mut cas);
+
+    let stats = build_warm_pack(&cas, &profile_data, output)
+        .map_err(|e| anyhow::anyhow!("Failed to build warm pack: {}", e))?;
+
+    let len = readahead(output)
+        .with_context(|| format!("Failed to readahead {}", output.display()))?;
+
+    println!("Warm pack built: {}", output.display());
+    println!("  Blobs:   {} ({})", format_number(stats.blobs), format_bytes(stats.bytes));
+    if stats.missing > 0 {
+        println!("  Missing: {} (stale profile entries, skipped)", format_number(stats.missing));
+    }
+    println!("  Readahead queued ({})", format_bytes(len));
+    Ok(())
+}
+
 fn cmd_resolve(cas_root: &Path, lockfile: &Path) -> Result<()> {
     if !lockfile.exists() {
         anyhow::bail!("Lockfile not found: {}", lockfile.display());
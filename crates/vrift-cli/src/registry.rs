@@ -277,39 +277,50 @@ impl ManifestRegistry {
     }
 
     /// Get all blob hashes referenced by all active manifests
+    ///
+    /// Manifest shards are independent, so each one is loaded and walked
+    /// on the rayon pool; the per-shard sets are unioned after the join.
     pub fn get_all_blob_hashes(&self) -> Result<HashSet<Blake3Hash>> {
-        let mut hashes = HashSet::new();
-
-        for entry in self.manifests.values() {
-            if entry.status != ManifestStatus::Active {
-                continue;
-            }
+        use rayon::prelude::*;
 
-            if !entry.source_path.exists() {
-                continue;
-            }
+        let active: Vec<&ManifestEntry> = self
+            .manifests
+            .values()
+            .filter(|e| e.status == ManifestStatus::Active && e.source_path.exists())
+            .collect();
 
-            if entry.source_path.is_dir() {
-                // RFC-0039: Load LMDB manifest
-                let lmdb = LmdbManifest::open(&entry.source_path).with_context(|| {
-                    format!("Failed to open LMDB manifest at {:?}", entry.source_path)
-                })?;
-                let entries = lmdb.iter().with_context(|| {
-                    format!("Failed to iterate LMDB manifest at {:?}", entry.source_path)
-                })?;
-                for (_, m_entry) in entries {
-                    hashes.insert(m_entry.vnode.content_hash);
-                }
-            } else {
-                // In-memory manifest (rkyv format)
-                let manifest = Manifest::load(&entry.source_path)
-                    .with_context(|| format!("Failed to load manifest: {:?}", entry.source_path))?;
-                for (_, vnode) in manifest.iter() {
-                    hashes.insert(vnode.content_hash);
+        let shard_sets: Vec<HashSet<Blake3Hash>> = active
+            .par_iter()
+            .map(|entry| -> Result<HashSet<Blake3Hash>> {
+                let mut hashes = HashSet::new();
+                if entry.source_path.is_dir() {
+                    // RFC-0039: Load LMDB manifest
+                    let lmdb = LmdbManifest::open(&entry.source_path).with_context(|| {
+                        format!("Failed to open LMDB manifest at {:?}", entry.source_path)
+                    })?;
+                    let entries = lmdb.iter().with_context(|| {
+                        format!("Failed to iterate LMDB manifest at {:?}", entry.source_path)
+                    })?;
+                    for (_, m_entry) in entries {
+                        hashes.insert(m_entry.vnode.content_hash);
+                    }
+                } else {
+                    // In-memory manifest (rkyv format)
+                    let manifest = Manifest::load(&entry.source_path).with_context(|| {
+                        format!("Failed to load manifest: {:?}", entry.source_path)
+                    })?;
+                    for (_, vnode) in manifest.iter() {
+                        hashes.insert(vnode.content_hash);
+                    }
                 }
-            }
-        }
+                Ok(hashes)
+            })
+            .collect::<Result<_>>()?;
 
+        let mut hashes = HashSet::new();
+        for set in shard_sets {
+            hashes.extend(set);
+        }
         Ok(hashes)
     }
 
@@ -0,0 +1,151 @@
+//! # vrift stats
+//!
+//! Live view of the inception layer's hot-path performance counters.
+//! Every shim process publishes a stats page under
+//! `<project>/.vrift/stats/shim_<pid>.stats`; we map each page read-only,
+//! sample twice, and print totals plus per-second rates. With `--watch`
+//! the sampling loop runs until interrupted.
+
+use anyhow::{Context, Result};
+use console::style;
+use std::path::{Path, PathBuf};
+use std::time::Duration;
+use vrift_ipc::stats_page::{
+    StatsPage, COUNTER_COUNT, COUNTER_NAMES, CTR_WORKER_POP, CTR_WORKER_PUSH,
+};
+
+/// One mapped shim page (kept alive for the sampling loop)
+struct MappedPage {
+    pid: u64,
+    _mmap: memmap2::Mmap,
+    page: &'static StatsPage,
+}
+
+/// Map every published stats page under `<project>/.vrift/stats/`.
+/// Pages whose shim process has exited are skipped.
+fn open_pages(project_dir: &Path) -> Result<Vec<MappedPage>> {
+    let stats_dir = project_dir.join(".vrift").join("stats");
+    let mut pages = Vec::new();
+
+    let entries = match std::fs::read_dir(&stats_dir) {
+        Ok(e) => e,
+        Err(_) => return Ok(pages), // no directory yet — no shim has run
+    };
+
+    for entry in entries.flatten() {
+        let path = entry.path();
+        if path.extension().and_then(|e| e.to_str()) != Some("stats") {
+            continue;
+        }
+        let Ok(file) = std::fs::File::open(&path) else {
+            continue;
+        };
+        let Ok(mmap) = (unsafe { memmap2::Mmap::map(&file) }) else {
+            continue;
+        };
+        // Safety: validated shared mapping; the Mmap is stored alongside the
+        // reference so it outlives it.
+        let Some(page) = (unsafe { StatsPage::from_raw(mmap.as_ptr(), mmap.len()) }) else {
+            continue;
+        };
+        let pid = page.pid.load(std::sync::atomic::Ordering::Relaxed);
+        if !process_alive(pid as i32) {
+            continue;
+        }
+        pages.push(MappedPage {
+            pid,
+            page,
+            _mmap: mmap,
+        });
+    }
+
+    pages.sort_by_key(|p| p.pid);
+    Ok(pages)
+}
+
+fn process_alive(pid: i32) -> bool {
+    pid > 0 && unsafe { libc::kill(pid, 0) } == 0
+}
+
+/// Aggregate one snapshot across all live shim pages
+fn sample(pages: &[MappedPage]) -> [u64; COUNTER_COUNT] {
+    let mut totals = [0u64; COUNTER_COUNT];
+    for p in pages {
+        let snap = p.page.snapshot();
+        for (total, v) in totals.iter_mut().zip(snap.iter()) {
+            *total += v;
+        }
+    }
+    totals
+}
+
+fn print_sample(
+    pages: &[MappedPage],
+    prev: &[u64; COUNTER_COUNT],
+    cur: &[u64; COUNTER_COUNT],
+    interval: Duration,
+) {
+    let secs = interval.as_secs_f64().max(0.001);
+    println!(
+        "{:<22} {:>14} {:>12}",
+        style("counter").bold(),
+        style("total").bold(),
+        style("per sec").bold()
+    );
+    for (i, name) in COUNTER_NAMES.iter().enumerate() {
+        let rate = (cur[i].saturating_sub(prev[i])) as f64 / secs;
+        println!("{:<22} {:>14} {:>12.1}", name, cur[i], rate);
+    }
+    // Derived gauge: outstanding background work
+    let depth = cur[CTR_WORKER_PUSH].saturating_sub(cur[CTR_WORKER_POP]);
+    println!("{:<22} {:>14}", "worker_queue_depth", depth);
+    println!(
+        "{}",
+        style(format!(
+            "{} shim process(es): {}",
+            pages.len(),
+            pages
+                .iter()
+                .map(|p| p.pid.to_string())
+                .collect::<Vec<_>>()
+                .join(", ")
+        ))
+        .dim()
+    );
+}
+
+pub fn cmd_stats(project_dir: &Path, interval_secs: f64, watch: bool) -> Result<()> {
+    let project_dir: PathBuf = project_dir
+        .canonicalize()
+        .with_context(|| format!("Invalid project directory: {}", project_dir.display()))?;
+    let interval = Duration::from_secs_f64(interval_secs.max(0.1));
+
+    let pages = open_pages(&project_dir)?;
+    if pages.is_empty() {
+        println!(
+            "{}",
+            style("No live stats pages found — is a build running under `vrift inception`?")
+                .yellow()
+        );
+        return Ok(());
+    }
+
+    println!(
+        "{}",
+        style(format!("📊 Velo Rift Stats — {}", project_dir.display()))
+            .bold()
+            .cyan()
+    );
+
+    let mut prev = sample(&pages);
+    loop {
+        std::thread::sleep(interval);
+        let cur = sample(&pages);
+        println!();
+        print_sample(&pages, &prev, &cur, interval);
+        if !watch {
+            return Ok(());
+        }
+        prev = cur;
+    }
+}
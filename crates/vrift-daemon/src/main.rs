@@ -1023,6 +1023,34 @@ async fn handle_request(
                 manifest_path,
             }
         }
+        VeloRequest::Batch(requests) => {
+            // Sub-requests are handled in order; responses mirror that order.
+            let mut responses = Vec::with_capacity(requests.len());
+            for sub in requests {
+                if matches!(sub, VeloRequest::Batch(_)) {
+                    responses.push(VeloResponse::Error(VeloError::internal("Nested batch")));
+                    continue;
+                }
+                responses.push(
+                    Box::pin(handle_request(
+                        sub,
+                        state,
+                        peer_creds,
+                        daemon_uid,
+                        current_vdird,
+                    ))
+                    .await,
+                );
+            }
+            VeloResponse::Batch(responses)
+        }
+        VeloRequest::RingSetup => {
+            // Rings are negotiated with the per-project vDird (Phase 1.2
+            // routing), never the global daemon
+            VeloResponse::Error(VeloError::internal(
+                "RingSetup must be sent to the project vDird socket",
+            ))
+        }
     }
 }
 
@@ -1060,6 +1088,10 @@ fn write_ingest_manifest(
         prefix_str.trim_end_matches('/')
     };
 
+    // Bulk load: one write txn with sorted keys instead of per-entry
+    // delta traffic (LMDB commit overhead dominated large ingests)
+    let mut bulk = manifest.begin_bulk();
+
     for result in results.iter().flatten() {
         // P1: Skip manifest write for cache-hit entries — their hash/mtime/size
         // are already correct in the existing manifest, no need to re-write.
@@ -1089,12 +1121,12 @@ fn write_ingest_manifest(
         // Create VnodeEntry
         let vnode = VnodeEntry::new_file(result.hash, result.size, mtime, mode);
 
-        // Insert into LMDB manifest
-        manifest.insert(&manifest_key, vnode, asset_tier);
+        // Stage into the bulk transaction
+        bulk.insert(&manifest_key, vnode, asset_tier);
     }
 
-    // Commit delta layer to LMDB base layer (required for persistence!)
-    manifest.commit()?;
+    // Single sorted write transaction (required for persistence!)
+    bulk.commit()?;
 
     // Phase 1.1: mmap cache is now managed by vDird subprocess, not vriftd
 
@@ -12,6 +12,7 @@ mod imp {
     use std::collections::HashMap;
     use std::ffi::OsStr;
     use std::path::Path;
+    use std::sync::{Arc, Mutex};
     use std::time::{Duration, UNIX_EPOCH};
 
     use fuser::{
@@ -21,37 +22,80 @@ mod imp {
     use vrift_cas::CasStore;
     use vrift_manifest::{Manifest, VnodeEntry};
 
-    const TTL: Duration = Duration::from_secs(60);
+    /// Entry/attribute cache TTL pushed to the kernel.
+    ///
+    /// The mounted manifest is an immutable snapshot, so the kernel can cache
+    /// dentries and attributes for the mount's lifetime — a long TTL turns
+    /// the lookup/getattr storm of a build into kernel-side cache hits. The
+    /// manifest version doubles as the FUSE generation, so a remount of a
+    /// newer snapshot invalidates stale kernel entries.
+    const TTL: Duration = Duration::from_secs(3600);
     const BLOCK_SIZE: u64 = 4096;
 
+    /// Bytes of madvise(WILLNEED) issued past the current read window, so
+    /// sequential consumers (compilers streaming sources, linkers walking
+    /// archives) find the next stripe already paged in.
+    const READAHEAD_WINDOW: usize = 4 * 1024 * 1024;
+
     struct InodeEntry {
         path_hash: vrift_manifest::PathHash,
         attr: FileAttr,
         children: Vec<(String, u64)>, // Name -> Inode
     }
 
-    pub struct VeloFs {
+    /// State shared between the session dispatch loop and read workers.
+    struct Shared {
         cas: CasStore,
         inodes: HashMap<u64, InodeEntry>,
-        path_to_inode: HashMap<String, u64>,
+        /// Manifest version, reported as the FUSE generation
+        generation: u64,
+        /// Per-inode mmap cache: reads serve slices straight out of the page
+        /// cache instead of re-reading (and re-hashing) the blob per request
+        file_cache: Mutex<HashMap<u64, Arc<memmap2::Mmap>>>,
+    }
+
+    impl Shared {
+        /// Get (or establish) the cached mapping for a file inode.
+        fn mapped(&self, ino: u64, hash: &vrift_manifest::PathHash) -> Option<Arc<memmap2::Mmap>> {
+            if let Some(m) = self.file_cache.lock().unwrap().get(&ino) {
+                return Some(Arc::clone(m));
+            }
+            let mmap = Arc::new(self.cas.get_mmap(hash).ok()?);
+            let cached = self
+                .file_cache
+                .lock()
+                .unwrap()
+                .entry(ino)
+                .or_insert(mmap)
+                .clone();
+            Some(cached)
+        }
+    }
+
+    pub struct VeloFs {
+        shared: Arc<Shared>,
     }
 
     impl VeloFs {
         pub fn new(manifest: &Manifest, cas: CasStore) -> Self {
-            let mut fs = Self {
-                cas,
-                inodes: HashMap::new(),
-                path_to_inode: HashMap::new(),
-            };
-            fs.init_from_manifest(manifest);
-            fs
+            let (inodes, _path_to_inode) = Self::init_from_manifest(manifest);
+            Self {
+                shared: Arc::new(Shared {
+                    cas,
+                    inodes,
+                    generation: manifest.version as u64,
+                    file_cache: Mutex::new(HashMap::new()),
+                }),
+            }
         }
 
         /// Mount the filesystem at the given path (Ref: <https://docs.rs/fuser>)
         pub fn mount(self, mountpoint: &Path) -> anyhow::Result<()> {
-            // Performance Optimization: TTL=60s (Implies metadata caching).
-            // auto_cache / kernel_cache causing issues with current fuser/libfuse version in CI.
-            // TTL=60s provides significant getattr reduction.
+            // fuser's session loop dispatches requests on one thread, but the
+            // data plane is offloaded: read() resolves the inode inline and
+            // hands the blob fetch + reply to rayon workers, so concurrent
+            // readers (parallel Go/C++ compile jobs) are served in parallel
+            // rather than queueing behind each other's I/O.
 
             let opts = vec![
                 fuser::MountOption::RO,
@@ -62,6 +106,24 @@ mod imp {
             Ok(())
         }
 
+        fn init_from_manifest(
+            manifest: &Manifest,
+        ) -> (HashMap<u64, InodeEntry>, HashMap<String, u64>) {
+            let mut builder = VeloFsBuilder {
+                inodes: HashMap::new(),
+                path_to_inode: HashMap::new(),
+            };
+            builder.init_from_manifest(manifest);
+            (builder.inodes, builder.path_to_inode)
+        }
+    }
+
+    struct VeloFsBuilder {
+        inodes: HashMap<u64, InodeEntry>,
+        path_to_inode: HashMap<String, u64>,
+    }
+
+    impl VeloFsBuilder {
         fn init_from_manifest(&mut self, manifest: &Manifest) {
             // 1. Assign inodes to all paths
             let mut next_inode = 2; // 1 is root
@@ -183,11 +245,11 @@ mod imp {
                 }
             };
 
-            if let Some(parent_entry) = self.inodes.get(&parent) {
+            if let Some(parent_entry) = self.shared.inodes.get(&parent) {
                 for (child_name, child_inode) in &parent_entry.children {
                     if child_name == name_str {
-                        if let Some(child_entry) = self.inodes.get(child_inode) {
-                            reply.entry(&TTL, &child_entry.attr, 0);
+                        if let Some(child_entry) = self.shared.inodes.get(child_inode) {
+                            reply.entry(&TTL, &child_entry.attr, self.shared.generation);
                             return;
                         }
                     }
@@ -197,12 +259,37 @@ mod imp {
         }
 
         fn getattr(&mut self, _req: &Request, ino: u64, reply: ReplyAttr) {
-            match self.inodes.get(&ino) {
+            match self.shared.inodes.get(&ino) {
                 Some(entry) => reply.attr(&TTL, &entry.attr),
                 None => reply.error(ENOENT),
             }
         }
 
+        fn open(&mut self, _req: &Request, ino: u64, _flags: c_int, reply: fuser::ReplyOpen) {
+            let entry = match self.shared.inodes.get(&ino) {
+                Some(e) => e,
+                None => {
+                    reply.error(ENOENT);
+                    return;
+                }
+            };
+
+            // Warm the mapping off-thread so the first read finds pages
+            // already in flight; FOPEN_KEEP_CACHE keeps kernel page cache
+            // contents valid across open() (blobs are immutable).
+            if entry.attr.kind == FileType::RegularFile && entry.attr.size > 0 {
+                let shared = Arc::clone(&self.shared);
+                let hash = entry.path_hash;
+                rayon::spawn(move || {
+                    if let Some(mmap) = shared.mapped(ino, &hash) {
+                        let len = mmap.len().min(READAHEAD_WINDOW);
+                        let _ = mmap.advise_range(memmap2::Advice::WillNeed, 0, len);
+                    }
+                });
+            }
+            reply.opened(0, fuser::consts::FOPEN_KEEP_CACHE);
+        }
+
         fn read(
             &mut self,
             _req: &Request,
@@ -214,7 +301,7 @@ mod imp {
             _lock_owner: Option<u64>,
             reply: ReplyData,
         ) {
-            let entry = match self.inodes.get(&ino) {
+            let entry = match self.shared.inodes.get(&ino) {
                 Some(e) => e,
                 None => {
                     reply.error(ENOENT);
@@ -222,19 +309,58 @@ mod imp {
                 }
             };
 
-            match self.cas.get(&entry.path_hash) {
-                Ok(data) => {
-                    let offset = offset as usize;
-                    let size = size as usize;
-                    if offset >= data.len() {
-                        reply.data(&[]);
-                    } else {
-                        let end = (offset + size).min(data.len());
-                        reply.data(&data[offset..end]);
+            if entry.attr.size == 0 {
+                reply.data(&[]);
+                return;
+            }
+
+            // Offload the data plane: the dispatch loop only resolves the
+            // inode, workers serve slices from the cached mapping and issue
+            // readahead for the stripe behind the current window.
+            let shared = Arc::clone(&self.shared);
+            let hash = entry.path_hash;
+            rayon::spawn(move || {
+                let mmap = match shared.mapped(ino, &hash) {
+                    Some(m) => m,
+                    None => {
+                        reply.error(libc::EIO);
+                        return;
                     }
+                };
+
+                let offset = offset as usize;
+                let size = size as usize;
+                if offset >= mmap.len() {
+                    reply.data(&[]);
+                    return;
                 }
-                Err(_) => reply.error(libc::EIO),
-            }
+                let end = (offset + size).min(mmap.len());
+
+                // Per-file readahead: hint the next window while this reply
+                // is in flight (best effort)
+                if end < mmap.len() {
+                    let ahead = (mmap.len() - end).min(READAHEAD_WINDOW);
+                    let _ = mmap.advise_range(memmap2::Advice::WillNeed, end, ahead);
+                }
+
+                reply.data(&mmap[offset..end]);
+            });
+        }
+
+        fn release(
+            &mut self,
+            _req: &Request,
+            ino: u64,
+            _fh: u64,
+            _flags: c_int,
+            _lock_owner: Option<u64>,
+            _flush: bool,
+            reply: fuser::ReplyEmpty,
+        ) {
+            // Drop the mapping once the last opener is gone; the kernel page
+            // cache (FOPEN_KEEP_CACHE) still serves re-opens without I/O.
+            self.shared.file_cache.lock().unwrap().remove(&ino);
+            reply.ok();
         }
 
         fn readdir(
@@ -245,7 +371,7 @@ mod imp {
             offset: i64,
             mut reply: ReplyDirectory,
         ) {
-            let entry = match self.inodes.get(&ino) {
+            let entry = match self.shared.inodes.get(&ino) {
                 Some(e) => e,
                 None => {
                     reply.error(ENOENT);
@@ -271,6 +397,7 @@ mod imp {
 
             for (i, (name, child_ino)) in entry.children.iter().enumerate().skip(skip) {
                 let child_type = self
+                    .shared
                     .inodes
                     .get(child_ino)
                     .map(|e| e.attr.kind)
@@ -67,6 +67,47 @@ extern int velo_fstatat_impl(int dirfd, const char *path, void *buf, int flags);
  */
 volatile char INITIALIZING = 2;
 
+/* --- VFS domain prefix filter ------------------------------------------
+ *
+ * The Rust init publishes the active mount prefixes (VFS prefix, project
+ * root, platform aliases) into this table once the state is up. Bridges
+ * then reject foreign absolute paths (/proc, /sys, /usr, build-tool /tmp
+ * traffic) with a prefix compare and go straight to the raw syscall —
+ * no Rust transition, no resolver, no guard.
+ *
+ * VR_PREFIX_COUNT is written LAST (after the arrays, with a release
+ * fence on the Rust side); 0 means "filter inactive", which fails safe
+ * into the full Rust path.
+ */
+#define VR_MAX_PREFIXES 4
+#define VR_PREFIX_CAP 1024
+volatile int VR_PREFIX_COUNT = 0;
+unsigned short VR_PREFIX_LEN[VR_MAX_PREFIXES];
+char VR_PREFIXES[VR_MAX_PREFIXES][VR_PREFIX_CAP];
+
+/* 1 = definitely outside every VFS domain: safe to bypass Rust entirely.
+ * 0 = in-domain or unknown (relative paths depend on cwd, ".." can
+ * lexically re-enter a domain) — take the full path. */
+int vr_path_foreign(const char *path) {
+  int n = VR_PREFIX_COUNT;
+  if (n <= 0 || path == 0)
+    return 0;
+  if (path[0] != '/')
+    return 0; /* relative: cwd may sit inside a domain */
+  for (const char *p = path; *p; p++) {
+    if (p[0] == '.' && p[1] == '.')
+      return 0; /* ".." needs lexical normalization */
+  }
+  for (int i = 0; i < n; i++) {
+    unsigned short len = VR_PREFIX_LEN[i];
+    if (__builtin_strncmp(path, VR_PREFIXES[i], len) == 0 &&
+        (path[len] == '/' || path[len] == '\0' ||
+         VR_PREFIXES[i][len - 1] == '/'))
+      return 0; /* component-boundary prefix match: in-domain */
+  }
+  return 1;
+}
+
 __attribute__((constructor(101))) void inception_init_constructor() {
   // RFC-0051: Ignore SIGPIPE to prevent IPC failures from killing processes
   signal(SIGPIPE, SIG_IGN);
@@ -155,7 +196,7 @@ int c_open_bridge(const char *path, int flags, ...) {
     mode = (mode_t)va_arg(args, int);
     va_end(args);
   }
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_OPEN, (long)path, (long)flags, (long)mode, 0);
   }
   return velo_open_impl(path, flags, mode);
@@ -169,7 +210,7 @@ int c_openat_bridge(int dirfd, const char *path, int flags, ...) {
     mode = (mode_t)va_arg(args, int);
     va_end(args);
   }
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_OPENAT, (long)dirfd, (long)path, (long)flags,
                             (long)mode);
   }
@@ -177,28 +218,28 @@ int c_openat_bridge(int dirfd, const char *path, int flags, ...) {
 }
 
 int c_stat_bridge(const char *path, void *buf) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_STAT64, (long)path, (long)buf, 0, 0);
   }
   return velo_stat_impl(path, buf);
 }
 
 int c_lstat_bridge(const char *path, void *buf) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_LSTAT64, (long)path, (long)buf, 0, 0);
   }
   return velo_lstat_impl(path, buf);
 }
 
 int c_access_bridge(const char *path, int mode) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_ACCESS, (long)path, (long)mode, 0, 0);
   }
   return velo_access_impl(path, mode);
 }
 
 long c_readlink_bridge(const char *path, char *buf, size_t bufsiz) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return raw_syscall(SYS_READLINK, (long)path, (long)buf, (long)bufsiz, 0);
   }
   return velo_readlink_impl(path, buf, bufsiz);
@@ -212,7 +253,7 @@ int c_fstat_bridge(int fd, void *buf) {
 }
 
 int c_fstatat_bridge(int dirfd, const char *path, void *buf, int flags) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_FSTATAT64, (long)dirfd, (long)path, (long)buf,
                             (long)flags);
   }
@@ -230,14 +271,14 @@ extern int velo_renameat_impl(int oldfd, const char *old, int newfd,
 
 #if defined(__APPLE__)
 int c_rename_bridge(const char *old, const char *new) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || (vr_path_foreign(old) && vr_path_foreign(new))) {
     return (int)raw_syscall(SYS_RENAME, (long)old, (long)new, 0, 0);
   }
   return velo_rename_impl(old, new);
 }
 
 int c_renameat_bridge(int oldfd, const char *old, int newfd, const char *new) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || (vr_path_foreign(old) && vr_path_foreign(new))) {
     return (int)raw_syscall(SYS_RENAMEAT, (long)oldfd, (long)old, (long)newfd,
                             (long)new);
   }
@@ -255,7 +296,7 @@ extern int setattrlist_inception(const char *path, void *attrlist,
                                  unsigned long options);
 
 int c_creat_bridge(const char *path, mode_t mode) {
-  if (INITIALIZING >= 2) {
+  if (INITIALIZING >= 2 || vr_path_foreign(path)) {
     return (int)raw_syscall(SYS_OPEN, (long)path,
                             (long)(O_CREAT | O_WRONLY | O_TRUNC), (long)mode,
                             0);
@@ -258,12 +258,6 @@ unsafe fn sync_rpc_vdird(
     vdird_socket_path: &str,
     request: &vrift_ipc::VeloRequest,
 ) -> Option<vrift_ipc::VeloResponse> {
-    use crate::state::{
-        EventType, CIRCUIT_BREAKER_FAILED_COUNT, CIRCUIT_BREAKER_THRESHOLD, CIRCUIT_RECOVERY_DELAY,
-        CIRCUIT_TRIPPED, CIRCUIT_TRIP_TIME,
-    };
-    use std::sync::atomic::Ordering;
-
     // If no vDird socket cached yet, fall back to daemon socket via sync_rpc
     if vdird_socket_path.is_empty() {
         // Fallback: use the daemon socket (which will trigger RegisterAck caching)
@@ -273,6 +267,24 @@ unsafe fn sync_rpc_vdird(
         return None;
     }
 
+    let payload = sync_rpc_vdird_payload(vdird_socket_path, request)?;
+    rkyv::from_bytes::<vrift_ipc::VeloResponse, rkyv::rancor::Error>(&payload).ok()
+}
+
+/// Core vDird round trip returning the raw response payload (circuit breaker,
+/// connect, send, receive). Hot paths pair this with
+/// `vrift_ipc::access_response` to read the archived reply straight out of
+/// the receive buffer without deserializing.
+unsafe fn sync_rpc_vdird_payload(
+    vdird_socket_path: &str,
+    request: &vrift_ipc::VeloRequest,
+) -> Option<Vec<u8>> {
+    use crate::state::{
+        EventType, CIRCUIT_BREAKER_FAILED_COUNT, CIRCUIT_BREAKER_THRESHOLD, CIRCUIT_RECOVERY_DELAY,
+        CIRCUIT_TRIPPED, CIRCUIT_TRIP_TIME,
+    };
+    use std::sync::atomic::Ordering;
+
     // Check circuit breaker (shared with daemon connection)
     if CIRCUIT_TRIPPED.load(Ordering::Relaxed) {
         let trip_time = CIRCUIT_TRIP_TIME.load(Ordering::Relaxed);
@@ -324,9 +336,9 @@ unsafe fn sync_rpc_vdird(
         return None;
     }
 
-    let response = recv_response_on_fd(fd);
+    let payload = recv_response_payload_on_fd(fd);
     ipc_raw_close(fd);
-    response
+    payload
 }
 
 pub(crate) unsafe fn sync_ipc_manifest_remove(vdird_socket: &str, path: &str) -> bool {
@@ -586,6 +598,178 @@ pub(crate) unsafe fn sync_ipc_fcntl_lock(
     false
 }
 
+// ==================== Shared-memory ring (manifest_get fast path) ====================
+//
+// One-time negotiation: send `RingSetup` over the vDird socket, raw-mmap the
+// ring file from the ack, then serve every subsequent ManifestGet through
+// shared memory — no connect/send/recv syscalls per lookup. Falls back to
+// the socket path whenever the ring is unavailable (setup failed, path too
+// long for a slot, or the poller timed out).
+
+/// Ring attach state machine: untried → in-progress → ready | failed.
+/// `failed` is sticky for the process lifetime; the socket path still works.
+const RING_UNTRIED: u32 = 0;
+const RING_ATTACHING: u32 = 1;
+const RING_READY: u32 = 2;
+const RING_FAILED: u32 = 3;
+
+static RING_STATE: std::sync::atomic::AtomicU32 = std::sync::atomic::AtomicU32::new(RING_UNTRIED);
+static RING_PTR: std::sync::atomic::AtomicUsize = std::sync::atomic::AtomicUsize::new(0);
+static RING_LEN: std::sync::atomic::AtomicUsize = std::sync::atomic::AtomicUsize::new(0);
+
+/// Raw open(O_RDWR) + mmap(PROT_READ|PROT_WRITE, MAP_SHARED) of the ring
+/// file. Same BUG-007b discipline as `raw_map_readonly` in state/init.rs:
+/// open and mmap are interposed, so only raw syscalls are allowed here.
+unsafe fn raw_map_ring(path_ptr: *const libc::c_char, len: usize) -> *mut u8 {
+    #[cfg(target_os = "macos")]
+    let fd = crate::syscalls::macos_raw::raw_open(path_ptr, libc::O_RDWR | libc::O_CLOEXEC, 0);
+    #[cfg(target_os = "linux")]
+    let fd = crate::syscalls::linux_raw::raw_openat(
+        libc::AT_FDCWD,
+        path_ptr,
+        libc::O_RDWR | libc::O_CLOEXEC,
+        0,
+    );
+    if fd < 0 {
+        return ptr::null_mut();
+    }
+
+    #[cfg(target_os = "macos")]
+    let map = crate::syscalls::macos_raw::raw_mmap(
+        ptr::null_mut(),
+        len,
+        libc::PROT_READ | libc::PROT_WRITE,
+        libc::MAP_SHARED,
+        fd,
+        0,
+    );
+    #[cfg(target_os = "linux")]
+    let map = crate::syscalls::linux_raw::raw_mmap(
+        ptr::null_mut(),
+        len,
+        libc::PROT_READ | libc::PROT_WRITE,
+        libc::MAP_SHARED,
+        fd,
+        0,
+    );
+
+    #[cfg(target_os = "macos")]
+    crate::syscalls::macos_raw::raw_close(fd);
+    #[cfg(target_os = "linux")]
+    crate::syscalls::linux_raw::raw_close(fd);
+
+    if map == libc::MAP_FAILED {
+        return ptr::null_mut();
+    }
+    map as *mut u8
+}
+
+/// Negotiate and attach the ring. Exactly one thread wins the CAS and does
+/// the RPC; losers (and every call while attaching) use the socket path.
+unsafe fn ring_attach(vdird_socket: &str) {
+    use std::sync::atomic::Ordering;
+
+    if RING_STATE
+        .compare_exchange(
+            RING_UNTRIED,
+            RING_ATTACHING,
+            Ordering::AcqRel,
+            Ordering::Relaxed,
+        )
+        .is_err()
+    {
+        return;
+    }
+
+    let ack = sync_rpc_vdird(vdird_socket, &vrift_ipc::VeloRequest::RingSetup);
+    let (shm_path, slots) = match ack {
+        Some(vrift_ipc::VeloResponse::RingSetupAck { shm_path, slots }) => (shm_path, slots),
+        _ => {
+            // Older daemon or transient failure — stay on the socket path
+            RING_STATE.store(RING_FAILED, Ordering::Release);
+            return;
+        }
+    };
+
+    let len = vrift_ipc::shm_ring::ShmRing::required_size(slots);
+    let path_cstr = match std::ffi::CString::new(shm_path) {
+        Ok(p) => p,
+        Err(_) => {
+            RING_STATE.store(RING_FAILED, Ordering::Release);
+            return;
+        }
+    };
+    let map = raw_map_ring(path_cstr.as_ptr(), len);
+    if map.is_null() || vrift_ipc::shm_ring::ShmRing::from_raw(map, len).is_none() {
+        if !map.is_null() {
+            libc::munmap(map as *mut libc::c_void, len);
+        }
+        RING_STATE.store(RING_FAILED, Ordering::Release);
+        return;
+    }
+
+    RING_PTR.store(map as usize, Ordering::Release);
+    RING_LEN.store(len, Ordering::Release);
+    RING_STATE.store(RING_READY, Ordering::Release);
+    inception_info!("Ring attached ({} slots)", slots);
+}
+
+/// Ring-first manifest lookup. Outer `None` means "ring unavailable, use
+/// the socket"; `Some(None)` is a definitive miss from the daemon.
+unsafe fn ring_manifest_get(
+    vdird_socket: &str,
+    path: &str,
+) -> Option<Option<vrift_ipc::VnodeEntry>> {
+    use std::sync::atomic::Ordering;
+    use vrift_ipc::shm_ring::{
+        ShmRing, RING_STATUS_FOUND, RING_STATUS_NOT_FOUND, RING_STATUS_TIMEOUT,
+    };
+
+    match RING_STATE.load(Ordering::Acquire) {
+        RING_READY => {}
+        RING_UNTRIED => {
+            ring_attach(vdird_socket);
+            if RING_STATE.load(Ordering::Acquire) != RING_READY {
+                return None;
+            }
+        }
+        _ => return None,
+    }
+
+    let ring = ShmRing::from_raw(
+        RING_PTR.load(Ordering::Acquire) as *const u8,
+        RING_LEN.load(Ordering::Acquire),
+    )?;
+    let (status, vnode) = ring.manifest_get(path.as_bytes())?;
+
+    match status {
+        RING_STATUS_FOUND => {
+            crate::stats::bump(crate::stats::CTR_RING_LOOKUP);
+            Some(Some(vrift_ipc::VnodeEntry {
+                content_hash: vnode.content_hash,
+                size: vnode.size,
+                mtime: vnode.mtime,
+                mode: vnode.mode,
+                flags: vnode.flags,
+                _pad: 0,
+            }))
+        }
+        RING_STATUS_NOT_FOUND => Some(None),
+        RING_STATUS_TIMEOUT => {
+            // The daemon never answered within the wait budget: it died or
+            // restarted, and a restart deletes `.vrift/rings/`, so no
+            // poller will ever touch this mapping again. Fail the ring for
+            // the process lifetime and let the socket path (which has a
+            // circuit breaker) carry every subsequent lookup.
+            RING_STATE.store(RING_FAILED, Ordering::Release);
+            inception_info!("Ring unanswered — failing over to the socket transport");
+            None
+        }
+        // RING_STATUS_ERROR or unknown: let the socket path report it
+        _ => None,
+    }
+}
+
 /// Query manifest for a single path via vDird
 /// Phase 1.2: Routes directly to vDird socket (no RegisterWorkspace needed)
 pub(crate) unsafe fn sync_ipc_manifest_get(
@@ -595,8 +779,35 @@ pub(crate) unsafe fn sync_ipc_manifest_get(
     let request = vrift_ipc::VeloRequest::ManifestGet {
         path: path.to_string(),
     };
-    match sync_rpc_vdird(vdird_socket, &request) {
-        Some(vrift_ipc::VeloResponse::ManifestAck { entry }) => entry,
+
+    // Cold path: no vDird socket cached yet, go through the daemon fallback
+    if vdird_socket.is_empty() {
+        return match sync_rpc_vdird(vdird_socket, &request) {
+            Some(vrift_ipc::VeloResponse::ManifestAck { entry }) => entry,
+            _ => None,
+        };
+    }
+
+    // Fast path: shared-memory ring, no socket syscalls per lookup
+    if let Some(result) = ring_manifest_get(vdird_socket, path) {
+        return result;
+    }
+
+    // Hot path: read the archived reply straight out of the receive buffer.
+    // Stat-shaped responses are pure scalars, so no deserialization or
+    // per-reply string allocation is needed.
+    let payload = sync_rpc_vdird_payload(vdird_socket, &request)?;
+    match vrift_ipc::access_response(&payload).ok()? {
+        vrift_ipc::ArchivedVeloResponse::ManifestAck { entry } => {
+            entry.as_ref().map(|e| vrift_ipc::VnodeEntry {
+                content_hash: e.content_hash,
+                size: e.size.to_native(),
+                mtime: e.mtime.to_native(),
+                mode: e.mode.to_native(),
+                flags: e.flags.to_native(),
+                _pad: 0,
+            })
+        }
         _ => None,
     }
 }
@@ -622,6 +833,13 @@ unsafe fn send_request_on_fd(fd: libc::c_int, request: &vrift_ipc::VeloRequest)
 
 // Helper: receive response on existing FD (v3 frame protocol)
 unsafe fn recv_response_on_fd(fd: libc::c_int) -> Option<vrift_ipc::VeloResponse> {
+    let payload = recv_response_payload_on_fd(fd)?;
+    rkyv::from_bytes::<vrift_ipc::VeloResponse, rkyv::rancor::Error>(&payload).ok()
+}
+
+// Helper: receive a response frame's raw payload on existing FD, without
+// deserializing. Hot paths access the archived bytes in place instead.
+unsafe fn recv_response_payload_on_fd(fd: libc::c_int) -> Option<Vec<u8>> {
     use vrift_ipc::IpcHeader;
 
     // Read header
@@ -646,7 +864,7 @@ unsafe fn recv_response_on_fd(fd: libc::c_int) -> Option<vrift_ipc::VeloResponse
         return None;
     }
 
-    rkyv::from_bytes::<vrift_ipc::VeloResponse, rkyv::rancor::Error>(&payload).ok()
+    Some(payload)
 }
 
 /// Query directory listing from vDird
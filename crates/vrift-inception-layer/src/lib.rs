@@ -48,6 +48,7 @@ pub mod path;
 pub mod raw_context;
 pub mod reals;
 pub mod state;
+pub mod stats;
 pub mod sync;
 pub mod syscalls;
 
@@ -25,7 +25,7 @@ use std::sync::atomic::Ordering;
 
 use super::{
     FixedString, IdentityBuildHasher, InceptionLayerState, LogLevel, CIRCUIT_BREAKER_THRESHOLD,
-    DEBUG_ENABLED, FLIGHT_RECORDER, LOGGER, LOG_LEVEL,
+    DEBUG_ENABLED, DIRIDX_PTR, DIRIDX_SIZE, FLIGHT_RECORDER, LOGGER, LOG_LEVEL,
 };
 
 impl InceptionLayerState {
@@ -357,6 +357,35 @@ impl InceptionLayerState {
         // Perform proactive environment audit (Safe: uses getenv and safe logger)
         unsafe { Self::audit_environment() };
 
+        // Publish the hot-path counter page for `vrift stats` (raw I/O only;
+        // failure is non-fatal — counters stay process-local)
+        unsafe { crate::stats::publish_stats_page((*ptr).project_root.as_str()) };
+
+        // Publish the mount prefixes to the C-side foreign-path filter so
+        // out-of-domain traffic (/proc, /usr, tool /tmp churn) costs one
+        // prefix compare plus the raw syscall instead of a Rust transition.
+        unsafe {
+            let state = &*ptr;
+            let mut prefixes: [&str; 4] = [""; 4];
+            let mut n = 0usize;
+            prefixes[n] = state.vfs_prefix.as_str();
+            n += 1;
+            if !state.project_root.is_empty() {
+                prefixes[n] = state.project_root.as_str();
+                n += 1;
+            }
+            // macOS: /tmp is a symlink into /private — cover both spellings
+            // so neither alias gets misclassified as foreign
+            #[cfg(target_os = "macos")]
+            if let Some(alias) = state.vfs_prefix.as_str().strip_prefix("/private") {
+                if !alias.is_empty() && n < prefixes.len() {
+                    prefixes[n] = alias;
+                    n += 1;
+                }
+            }
+            crate::state::publish_prefix_filter(&prefixes[..n]);
+        }
+
         // Install custom panic handler for better diagnostics (Phase 5)
         install_panic_handler();
 
@@ -380,13 +409,13 @@ impl InceptionLayerState {
         }
     }
 
-    #[allow(clippy::large_stack_frames)] // Reactor contains RingBuffer (197KB) — runs once during cold init
-    pub(super) fn init_reactor() -> &'static crate::sync::RingBuffer {
+    #[allow(clippy::large_stack_frames)] // Reactor contains RingSet (~200KB) — runs once during cold init
+    pub(super) fn init_reactor() -> &'static crate::sync::RingSet {
         unsafe {
             if crate::sync::get_reactor().is_none() {
                 let reactor = crate::sync::Reactor {
                     fd_table: crate::sync::FdTable::new(),
-                    ring_buffer: crate::sync::RingBuffer::new(),
+                    ring_buffer: crate::sync::RingSet::new(),
                     started: std::sync::atomic::AtomicBool::new(true),
                 };
                 // Use addr_of_mut to avoid creating a reference to static mut
@@ -518,15 +547,75 @@ pub(crate) fn open_manifest_mmap() -> (*const u8, usize) {
 
     let mmap_path_ptr = path_buf.as_ptr() as *const libc::c_char;
 
+    let (ptr, size) = raw_map_readonly(mmap_path_ptr);
+    if ptr.is_null() {
+        return (ptr::null(), 0);
+    }
+    let ptr = ptr as *mut libc::c_void;
+
+    // Phase 1.3: Validate VDirHeader magic instead of ManifestMmapHeader
+    use vrift_ipc::vdir_types::{VDIR_HEADER_SIZE, VDIR_MAGIC};
+    if size < VDIR_HEADER_SIZE {
+        unsafe { libc::munmap(ptr, size) };
+        return (ptr::null(), 0);
+    }
+    let magic = unsafe { *(ptr as *const u32) };
+    if magic != VDIR_MAGIC {
+        // Fallback: Try legacy ManifestMmapHeader format
+        if size >= vrift_ipc::ManifestMmapHeader::SIZE {
+            let header = unsafe { &*(ptr as *const vrift_ipc::ManifestMmapHeader) };
+            if header.is_valid() {
+                return (ptr as *const u8, size);
+            }
+        }
+        unsafe { libc::munmap(ptr, size) };
+        return (ptr::null(), 0);
+    }
+
+    // Map the sibling directory-listing index (`<vdir>.diridx`, built by
+    // vDird). Optional: readdir falls back to IPC when it's absent or stale.
+    open_diridx_mmap(&mut path_buf);
+
+    (ptr as *const u8, size)
+}
+
+/// Map the `<vdir>.diridx` file read-only and publish it via DIRIDX_PTR /
+/// DIRIDX_SIZE. `path_buf` holds the NUL-terminated VDir mmap path; the
+/// `.diridx` suffix is appended in place.
+fn open_diridx_mmap(path_buf: &mut [u8; 1024]) {
+    use vrift_ipc::vdir_types::{DIRIDX_HEADER_SIZE, DIRIDX_MAGIC};
+
+    let vdir_len = path_buf.iter().position(|&b| b == 0).unwrap_or(0);
+    const SUFFIX: &[u8] = b".diridx\0";
+    if vdir_len == 0 || vdir_len + SUFFIX.len() > path_buf.len() {
+        return;
+    }
+    path_buf[vdir_len..vdir_len + SUFFIX.len()].copy_from_slice(SUFFIX);
+
+    let (ptr, size) = raw_map_readonly(path_buf.as_ptr() as *const libc::c_char);
+    if ptr.is_null() {
+        return;
+    }
+    if size < DIRIDX_HEADER_SIZE || unsafe { *(ptr as *const u32) } != DIRIDX_MAGIC {
+        unsafe { libc::munmap(ptr as *mut libc::c_void, size) };
+        return;
+    }
+
+    DIRIDX_PTR.store(ptr as usize, Ordering::Release);
+    DIRIDX_SIZE.store(size, Ordering::Release);
+}
+
+/// Raw open + fstat + mmap(PROT_READ, MAP_SHARED) of a file, no libc wrappers
+/// (BUG-007b). Returns (null, 0) on any failure.
+fn raw_map_readonly(path_ptr: *const libc::c_char) -> (*const u8, usize) {
     #[cfg(target_os = "macos")]
-    let fd = unsafe {
-        crate::syscalls::macos_raw::raw_open(mmap_path_ptr, libc::O_RDONLY | libc::O_CLOEXEC, 0)
-    };
+    let fd =
+        unsafe { crate::syscalls::macos_raw::raw_open(path_ptr, libc::O_RDONLY | libc::O_CLOEXEC, 0) };
     #[cfg(target_os = "linux")]
     let fd = unsafe {
         crate::syscalls::linux_raw::raw_openat(
             libc::AT_FDCWD,
-            mmap_path_ptr,
+            path_ptr,
             libc::O_RDONLY | libc::O_CLOEXEC,
             0,
         )
@@ -590,25 +679,6 @@ pub(crate) fn open_manifest_mmap() -> (*const u8, usize) {
         return (ptr::null(), 0);
     }
 
-    // Phase 1.3: Validate VDirHeader magic instead of ManifestMmapHeader
-    use vrift_ipc::vdir_types::{VDIR_HEADER_SIZE, VDIR_MAGIC};
-    if size < VDIR_HEADER_SIZE {
-        unsafe { libc::munmap(ptr, size) };
-        return (ptr::null(), 0);
-    }
-    let magic = unsafe { *(ptr as *const u32) };
-    if magic != VDIR_MAGIC {
-        // Fallback: Try legacy ManifestMmapHeader format
-        if size >= vrift_ipc::ManifestMmapHeader::SIZE {
-            let header = unsafe { &*(ptr as *const vrift_ipc::ManifestMmapHeader) };
-            if header.is_valid() {
-                return (ptr as *const u8, size);
-            }
-        }
-        unsafe { libc::munmap(ptr, size) };
-        return (ptr::null(), 0);
-    }
-
     (ptr as *const u8, size)
 }
 
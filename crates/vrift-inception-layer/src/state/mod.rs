@@ -56,6 +56,49 @@ extern "C" {
     /// RFC-0050: Initialization state machine
     /// 0: Ready (Active), 1: Rust-Init (Safe), 2: Early-Init (Hazardous), 3: Busy (Initializing)
     pub static INITIALIZING: std::sync::atomic::AtomicU8;
+
+    /// C-side VFS domain prefix table (variadic_inception.c). Written once
+    /// by `publish_prefix_filter`, read lock-free by the C bridges and the
+    /// Rust entry points. COUNT is the activation flag and is written last.
+    static mut VR_PREFIX_COUNT: libc::c_int;
+    static mut VR_PREFIX_LEN: [u16; VR_MAX_PREFIXES];
+    static mut VR_PREFIXES: [[libc::c_char; VR_PREFIX_CAP]; VR_MAX_PREFIXES];
+
+    /// 1 = path is outside every VFS domain (safe to raw-syscall directly),
+    /// 0 = in-domain or undecidable (relative path, "..", filter inactive)
+    pub fn vr_path_foreign(path: *const libc::c_char) -> libc::c_int;
+}
+
+/// Must match VR_MAX_PREFIXES / VR_PREFIX_CAP in variadic_inception.c
+const VR_MAX_PREFIXES: usize = 4;
+const VR_PREFIX_CAP: usize = 1024;
+
+/// Publish the active mount prefixes to the C-side fast-path filter.
+///
+/// Called once from init after the state is live. Array contents are
+/// written before the count (release fence), so a bridge that observes
+/// COUNT > 0 sees fully written prefixes; until then the filter is
+/// inactive and every call takes the full Rust path.
+pub(crate) unsafe fn publish_prefix_filter(prefixes: &[&str]) {
+    let mut published = 0usize;
+    for prefix in prefixes {
+        if published >= VR_MAX_PREFIXES {
+            break;
+        }
+        let bytes = prefix.as_bytes();
+        // Leave room for the implicit terminator; skip empty/oversized
+        if bytes.is_empty() || bytes.len() >= VR_PREFIX_CAP {
+            continue;
+        }
+        for (i, &b) in bytes.iter().enumerate() {
+            VR_PREFIXES[published][i] = b as libc::c_char;
+        }
+        VR_PREFIXES[published][bytes.len()] = 0;
+        VR_PREFIX_LEN[published] = bytes.len() as u16;
+        published += 1;
+    }
+    std::sync::atomic::fence(Ordering::Release);
+    std::ptr::write_volatile(std::ptr::addr_of_mut!(VR_PREFIX_COUNT), published as libc::c_int);
 }
 
 #[repr(u8)]
@@ -171,6 +214,9 @@ impl Default for FlightRecorder {
 impl FlightRecorder {
     #[inline(always)]
     pub fn record(&self, event: EventType, file_id: u64, result: i32) {
+        // Stats page counters piggyback on the recorder's call sites: one
+        // relaxed add per event, always on.
+        crate::stats::bump_event(event);
         let idx = self.head.fetch_add(1, Ordering::Relaxed) % FLIGHT_RECORDER_SIZE;
         // Safety: We are writing to a pre-allocated buffer.
         // In a high-concurrency dylib, we accept that entries might be semi-corrupted
@@ -205,17 +251,29 @@ pub static EVENT_NAMES: &[&str] = &[
 ];
 
 // ============================================================================
-// DirtyTracker: Lock-Free Pending Write Tracking (M3: Dirty Bit Logic)
+// DirtyTracker: Sharded Lock-Free Pending Write Tracking (M3/M4: Dirty Bit)
 // ============================================================================
 //
 // Tracks paths that have been opened for writing and are in staging files.
-// Uses a lock-free fixed-size hash table with linear probing.
+// Sharded layout: the path hash selects one of DIRTY_SHARD_COUNT independent
+// shards and linear probing never leaves it, so concurrent writers touch
+// disjoint cache-line regions. A global dirty_count makes the common
+// all-clean case a single relaxed load, and each slot carries a
+// seqlock-published copy of the live staging path so stat() resolves dirty
+// hits without scanning the FdTable.
 // ZERO ALLOCATIONS - safe to call during dyld bootstrap phase.
 
-/// Dirty tracker slot: stores path_hash and staging path offset
-/// Format: [32-bit path_hash | 32-bit staging_idx]
-/// path_hash = 0 means empty slot
-const DIRTY_TRACKER_SIZE: usize = 1024; // Max concurrent dirty files
+/// Shards probed independently; picked from high hash bits (power of two)
+const DIRTY_SHARD_COUNT: usize = 16;
+
+/// Slots per shard (power of two); 16 x 64 = 1024 max concurrent dirty files
+const DIRTY_SLOTS_PER_SHARD: usize = 64;
+
+/// Per-slot staging path capacity. Staging paths are
+/// `<project_root>/.vrift/staging/vrift_cow_*.tmp`; anything longer skips
+/// publication and readers fall back to the FdTable scan. Kept small so the
+/// whole tracker stays stack-constructible in tests (~0.5 MB).
+const DIRTY_TEMP_PATH_CAP: usize = 512;
 
 /// Tombstone marker for deleted slots (allows linear probing to continue)
 const TOMBSTONE: u64 = u64::MAX;
@@ -236,14 +294,36 @@ pub fn fnv1a_hash(path: &str) -> u64 {
     hash
 }
 
-/// Lock-free dirty file tracker
+/// One dirty-table slot: a tag plus a seqlock-published staging path.
+struct DirtySlot {
+    /// 0 = empty, TOMBSTONE = cleared, anything else = fnv1a path hash
+    tag: AtomicU64,
+    /// Seqlock over `temp`: odd = writer in progress
+    seq: std::sync::atomic::AtomicU32,
+    /// Published length of `temp` (0 = no staging path yet)
+    temp_len: std::sync::atomic::AtomicU32,
+    /// Live staging path bytes, valid while `seq` is stable and even
+    temp: std::cell::UnsafeCell<[u8; DIRTY_TEMP_PATH_CAP]>,
+}
+
+/// Probing is confined to one shard, so writers in different shards never
+/// contend on the same cache lines.
+struct DirtyShard {
+    slots: [DirtySlot; DIRTY_SLOTS_PER_SHARD],
+}
+
+/// Sharded lock-free dirty file tracker
 /// Tracks which paths have pending writes in staging files.
 pub struct DirtyTracker {
-    /// Fixed-size hash table: path_hash -> (staging_idx, active flag)
-    /// 0 = empty slot, non-zero = path_hash of dirty file
-    slots: [std::sync::atomic::AtomicU64; DIRTY_TRACKER_SIZE],
+    /// Live entry count; 0 means everything is clean (is_dirty fast path)
+    dirty_count: AtomicU64,
+    shards: [DirtyShard; DIRTY_SHARD_COUNT],
 }
 
+// SAFETY: the UnsafeCell temp buffers are only written under the per-slot
+// seqlock (odd seq) and readers validate seq stability before using a copy.
+unsafe impl Sync for DirtyTracker {}
+
 impl Default for DirtyTracker {
     fn default() -> Self {
         Self::new()
@@ -252,72 +332,207 @@ impl Default for DirtyTracker {
 
 impl DirtyTracker {
     pub const fn new() -> Self {
-        // Initialize all slots to 0 (empty)
         #[allow(clippy::declare_interior_mutable_const)]
-        const ZERO: std::sync::atomic::AtomicU64 = std::sync::atomic::AtomicU64::new(0);
+        const EMPTY_SLOT: DirtySlot = DirtySlot {
+            tag: AtomicU64::new(0),
+            seq: std::sync::atomic::AtomicU32::new(0),
+            temp_len: std::sync::atomic::AtomicU32::new(0),
+            temp: std::cell::UnsafeCell::new([0u8; DIRTY_TEMP_PATH_CAP]),
+        };
+        #[allow(clippy::declare_interior_mutable_const)]
+        const EMPTY_SHARD: DirtyShard = DirtyShard {
+            slots: [EMPTY_SLOT; DIRTY_SLOTS_PER_SHARD],
+        };
         Self {
-            slots: [ZERO; DIRTY_TRACKER_SIZE],
+            dirty_count: AtomicU64::new(0),
+            shards: [EMPTY_SHARD; DIRTY_SHARD_COUNT],
+        }
+    }
+
+    /// Shard selection uses high hash bits so it stays decorrelated from the
+    /// in-shard probe start (low bits).
+    #[inline(always)]
+    fn shard(&self, hash: u64) -> &DirtyShard {
+        &self.shards[((hash >> 48) as usize) & (DIRTY_SHARD_COUNT - 1)]
+    }
+
+    /// Probe a shard for the slot holding `hash`. None = definitively absent.
+    #[inline]
+    fn find_slot(&self, hash: u64) -> Option<&DirtySlot> {
+        let shard = self.shard(hash);
+        let mask = DIRTY_SLOTS_PER_SHARD - 1;
+        let start = (hash as usize) & mask;
+        for i in 0..DIRTY_SLOTS_PER_SHARD {
+            let slot = &shard.slots[(start + i) & mask];
+            let current = slot.tag.load(Ordering::Acquire);
+            if current == hash {
+                return Some(slot);
+            }
+            if current == 0 {
+                return None; // Empty slot terminates the probe chain
+            }
+            // Skip tombstones and other hashes
         }
+        None
     }
 
     /// Mark a path as dirty (has pending writes in staging)
-    /// Returns true if successfully marked, false if table is full
+    /// Returns true if successfully marked, false if the shard is full
     #[inline]
     pub fn mark_dirty(&self, path: &str) -> bool {
         let hash = fnv1a_hash(path);
-        if hash == 0 {
-            return false; // 0 is reserved for empty
+        if hash == 0 || hash == TOMBSTONE {
+            return false; // Reserved markers
         }
 
-        let start_slot = (hash as usize) % DIRTY_TRACKER_SIZE;
-        for i in 0..DIRTY_TRACKER_SIZE {
-            let slot = (start_slot + i) % DIRTY_TRACKER_SIZE;
-            let current = self.slots[slot].load(Ordering::Acquire);
-
-            // Empty slot - try to claim it
-            if current == 0
-                && self.slots[slot]
-                    .compare_exchange(0, hash, Ordering::SeqCst, Ordering::Acquire)
-                    .is_ok()
-            {
-                return true;
+        let shard = self.shard(hash);
+        let mask = DIRTY_SLOTS_PER_SHARD - 1;
+        let start = (hash as usize) & mask;
+
+        // Bounded retries: a CAS only loses to a concurrent insert into the
+        // same shard, so contention here is rare and short.
+        for _ in 0..4 {
+            // Scan the whole chain first so a tombstone is never claimed
+            // while the hash lives further down the probe sequence.
+            let mut free: Option<(usize, u64)> = None;
+            let mut target: Option<(usize, u64)> = None;
+            for i in 0..DIRTY_SLOTS_PER_SHARD {
+                let idx = (start + i) & mask;
+                let current = shard.slots[idx].tag.load(Ordering::Acquire);
+                if current == hash {
+                    return true; // Already marked dirty
+                }
+                if current == TOMBSTONE {
+                    if free.is_none() {
+                        free = Some((idx, TOMBSTONE));
+                    }
+                    continue;
+                }
+                if current == 0 {
+                    target = Some(free.unwrap_or((idx, 0)));
+                    break;
+                }
             }
-            // CAS failed or slot occupied, continue probing
 
-            // Already marked dirty
-            if current == hash {
+            let (idx, expected) = match target.or(free) {
+                Some(t) => t,
+                None => return false, // Shard full
+            };
+            let slot = &shard.slots[idx];
+            if slot
+                .tag
+                .compare_exchange(expected, hash, Ordering::SeqCst, Ordering::Acquire)
+                .is_ok()
+            {
+                // Drop any staging path left behind by a previous occupant.
+                slot.temp_len.store(0, Ordering::Release);
+                self.dirty_count.fetch_add(1, Ordering::Release);
                 return true;
             }
+            // Lost the race (possibly to our own hash) - re-scan.
         }
-        false // Table full
+        false
     }
 
-    /// Clear dirty status for a path
-    /// Called after staging file is committed to CAS
-    pub fn clear_dirty(&self, path: &str) {
+    /// Publish the live staging path for a dirty entry so readers can stat
+    /// it directly instead of scanning the FdTable.
+    ///
+    /// Seqlock write protocol: CAS even->odd claims the buffer, bytes are
+    /// copied, then seq advances to the next even value. Concurrent CoW
+    /// opens of the same path therefore never interleave bytes.
+    pub fn set_temp_path(&self, path: &str, temp: &str) {
         let hash = fnv1a_hash(path);
-        if hash == 0 {
+        if hash == 0 || hash == TOMBSTONE {
             return;
         }
+        let slot = match self.find_slot(hash) {
+            Some(s) => s,
+            None => return, // Not dirty (already reingested) - nothing to publish
+        };
 
-        let start_slot = (hash as usize) % DIRTY_TRACKER_SIZE;
-        for i in 0..DIRTY_TRACKER_SIZE {
-            let slot = (start_slot + i) % DIRTY_TRACKER_SIZE;
-            let current = self.slots[slot].load(Ordering::Acquire);
-
-            if current == 0 {
-                return; // Empty slot - not found
+        let bytes = temp.as_bytes();
+        let len = bytes.len();
+        if len > DIRTY_TEMP_PATH_CAP {
+            return; // Too long to publish - readers fall back to the FdTable
+        }
+        for _ in 0..8 {
+            let seq = slot.seq.load(Ordering::Acquire);
+            if seq & 1 != 0 {
+                std::hint::spin_loop();
+                continue; // Another writer holds the buffer
             }
+            if slot
+                .seq
+                .compare_exchange(seq, seq + 1, Ordering::AcqRel, Ordering::Relaxed)
+                .is_err()
+            {
+                continue;
+            }
+            unsafe {
+                std::ptr::copy_nonoverlapping(bytes.as_ptr(), (*slot.temp.get()).as_mut_ptr(), len);
+            }
+            slot.temp_len.store(len as u32, Ordering::Release);
+            slot.seq.store(seq + 2, Ordering::Release);
+            return;
+        }
+    }
 
-            if current == hash {
-                // Found - mark as tombstone (allows probing to continue)
-                self.slots[slot].store(TOMBSTONE, Ordering::Release);
-                return;
+    /// Get the published staging path for a dirty entry, if any.
+    /// Lock-free: copies out under the slot seqlock, never blocks writers.
+    pub fn temp_path_for(&self, path: &str) -> Option<FixedString<1024>> {
+        if self.dirty_count.load(Ordering::Relaxed) == 0 {
+            return None;
+        }
+        let hash = fnv1a_hash(path);
+        if hash == 0 || hash == TOMBSTONE {
+            return None;
+        }
+        let slot = self.find_slot(hash)?;
+
+        let mut buf = [0u8; DIRTY_TEMP_PATH_CAP];
+        for _ in 0..8 {
+            let seq = slot.seq.load(Ordering::Acquire);
+            if seq & 1 != 0 {
+                std::hint::spin_loop();
+                continue; // Writer in progress
+            }
+            let len = slot.temp_len.load(Ordering::Acquire) as usize;
+            if len == 0 || len > DIRTY_TEMP_PATH_CAP {
+                return None; // No staging path published yet
+            }
+            unsafe {
+                std::ptr::copy_nonoverlapping((*slot.temp.get()).as_ptr(), buf.as_mut_ptr(), len);
             }
+            if slot.seq.load(Ordering::Acquire) != seq {
+                continue; // Torn read - retry
+            }
+            let s = std::str::from_utf8(&buf[..len]).ok()?;
+            let mut out = FixedString::new();
+            out.set(s);
+            return Some(out);
+        }
+        None
+    }
 
-            // Skip tombstones during search
-            if current == TOMBSTONE {
-                continue;
+    /// Clear dirty status for a path
+    /// Called after staging file is committed to CAS
+    pub fn clear_dirty(&self, path: &str) {
+        let hash = fnv1a_hash(path);
+        if hash == 0 || hash == TOMBSTONE {
+            return;
+        }
+        if self.dirty_count.load(Ordering::Relaxed) == 0 {
+            return;
+        }
+        if let Some(slot) = self.find_slot(hash) {
+            slot.temp_len.store(0, Ordering::Release);
+            // CAS so racing clears decrement dirty_count exactly once.
+            if slot
+                .tag
+                .compare_exchange(hash, TOMBSTONE, Ordering::SeqCst, Ordering::Relaxed)
+                .is_ok()
+            {
+                self.dirty_count.fetch_sub(1, Ordering::Release);
             }
         }
     }
@@ -326,45 +541,123 @@ impl DirtyTracker {
     /// Used in stat/read to redirect to staging file
     #[inline]
     pub fn is_dirty(&self, path: &str) -> bool {
-        let hash = fnv1a_hash(path);
-        if hash == 0 {
+        // Epoch fast path: nothing dirty anywhere - a single relaxed load.
+        if self.dirty_count.load(Ordering::Relaxed) == 0 {
             return false;
         }
-
-        let start_slot = (hash as usize) % DIRTY_TRACKER_SIZE;
-        for i in 0..DIRTY_TRACKER_SIZE {
-            let slot = (start_slot + i) % DIRTY_TRACKER_SIZE;
-            let current = self.slots[slot].load(Ordering::Acquire);
-
-            if current == 0 {
-                return false; // Empty slot - not found
-            }
-
-            if current == hash {
-                return true; // Found - is dirty
-            }
-
-            // Skip tombstones during search
-            if current == TOMBSTONE {
-                continue;
-            }
+        let hash = fnv1a_hash(path);
+        if hash == 0 || hash == TOMBSTONE {
+            return false;
         }
-        false
+        self.find_slot(hash).is_some()
     }
 
     /// Get count of dirty entries (for debugging)
     #[allow(dead_code)]
     pub fn count(&self) -> usize {
-        self.slots
+        self.shards
             .iter()
+            .flat_map(|shard| shard.slots.iter())
             .filter(|s| {
-                let v = s.load(Ordering::Relaxed);
+                let v = s.tag.load(Ordering::Relaxed);
                 v != 0 && v != TOMBSTONE
             })
             .count()
     }
 }
 
+/// Negative cache capacity (direct-mapped; collisions just evict)
+const NEG_CACHE_SIZE: usize = 4096;
+
+/// Global negative-path cache instance
+pub static NEG_PATH_CACHE: NegativePathCache = NegativePathCache::new();
+
+/// Lock-free negative-path cache for confirmed manifest misses.
+///
+/// Compilers probe dozens of `-I` include directories per header, and the
+/// vast majority of those stats are ENOENT. Without this cache every repeat
+/// probe for a path inside the VFS domain pays a vDird round trip just to be
+/// told "not found" again.
+///
+/// The cache is tagged with the VDir seqlock generation it was observed
+/// under. Any vDird write bumps that generation, so a freshly ingested path
+/// can never be shadowed by a stale negative entry: `contains` requires the
+/// caller's current generation to match exactly, and `insert` resets the
+/// table when the generation moves forward.
+pub struct NegativePathCache {
+    /// VDir generation the cached misses belong to
+    /// (0 = unset, u64::MAX = reset in progress)
+    generation: std::sync::atomic::AtomicU64,
+    /// Direct-mapped table of manifest key hashes; 0 = empty slot
+    slots: [std::sync::atomic::AtomicU64; NEG_CACHE_SIZE],
+}
+
+impl Default for NegativePathCache {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl NegativePathCache {
+    pub const fn new() -> Self {
+        #[allow(clippy::declare_interior_mutable_const)]
+        const ZERO: std::sync::atomic::AtomicU64 = std::sync::atomic::AtomicU64::new(0);
+        Self {
+            generation: std::sync::atomic::AtomicU64::new(0),
+            slots: [ZERO; NEG_CACHE_SIZE],
+        }
+    }
+
+    /// Check if a path hash is a known miss under the given VDir generation.
+    /// `vdir_generation` must be the generation read from the mmap just now;
+    /// a mismatch means the cache predates the latest vDird write.
+    #[inline]
+    pub fn contains(&self, path_hash: u64, vdir_generation: u64) -> bool {
+        if path_hash == 0 || vdir_generation == 0 {
+            return false;
+        }
+        if self.generation.load(Ordering::Acquire) != vdir_generation {
+            return false;
+        }
+        self.slots[(path_hash as usize) % NEG_CACHE_SIZE].load(Ordering::Acquire) == path_hash
+    }
+
+    /// Record a confirmed miss observed under `vdir_generation` (must be the
+    /// generation read BEFORE the lookup, so a concurrent vDird write
+    /// invalidates the entry instead of poisoning it).
+    #[inline]
+    pub fn insert(&self, path_hash: u64, vdir_generation: u64) {
+        if path_hash == 0 || vdir_generation == 0 || vdir_generation & 1 != 0 {
+            return;
+        }
+        let cached = self.generation.load(Ordering::Acquire);
+        if cached != vdir_generation {
+            if cached == u64::MAX {
+                // Another thread is mid-reset; drop this insert (it's a cache)
+                return;
+            }
+            // Generations only move forward; never re-tag with an older one
+            if cached != 0 && vdir_generation < cached {
+                return;
+            }
+            // Winner parks generation at MAX, clears, then publishes the new
+            // generation — readers see either the old tag or a clean table.
+            if self
+                .generation
+                .compare_exchange(cached, u64::MAX, Ordering::AcqRel, Ordering::Acquire)
+                .is_err()
+            {
+                return;
+            }
+            for slot in &self.slots {
+                slot.store(0, Ordering::Relaxed);
+            }
+            self.generation.store(vdir_generation, Ordering::Release);
+        }
+        self.slots[(path_hash as usize) % NEG_CACHE_SIZE].store(path_hash, Ordering::Release);
+    }
+}
+
 #[inline(always)]
 fn rdtsc() -> u64 {
     #[cfg(target_arch = "x86_64")]
@@ -810,6 +1103,164 @@ pub(crate) struct VDirStatResult {
 /// Prevents infinite hang if vDird crashes mid-write (odd generation stuck).
 const MAX_SEQLOCK_SPINS: u32 = 1000;
 
+/// Directory-listing index mapping (`<vdir>.diridx`), published by
+/// open_diridx_mmap at init. 0 = not mapped; readdir falls back to IPC.
+pub(crate) static DIRIDX_PTR: AtomicUsize = AtomicUsize::new(0);
+pub(crate) static DIRIDX_SIZE: AtomicUsize = AtomicUsize::new(0);
+
+/// Serve a directory listing from the mmap dir index built by vDird.
+///
+/// `live_vdir_generation` must be the VDir generation read just now; the
+/// index records the generation it was built from and any mismatch means
+/// the snapshot is stale — return None and let the caller use IPC.
+///
+/// One contiguous scan of the children pool: no IPC, no per-entry hashing.
+pub(crate) fn diridx_list(
+    dir_key: &str,
+    live_vdir_generation: u64,
+) -> Option<Vec<vrift_ipc::DirEntry>> {
+    use vrift_ipc::vdir_types::{
+        DirIndexChild, DirIndexSlot, DIRIDX_CHILD_HEADER_SIZE, DIRIDX_DT_DIR, DIRIDX_HEADER_SIZE,
+        DIRIDX_MAGIC, DIRIDX_SLOT_SIZE,
+    };
+
+    let mmap_ptr = DIRIDX_PTR.load(Ordering::Acquire) as *const u8;
+    let mmap_size = DIRIDX_SIZE.load(Ordering::Acquire);
+    if mmap_ptr.is_null() || mmap_size < DIRIDX_HEADER_SIZE {
+        return None;
+    }
+    let magic = unsafe { *(mmap_ptr as *const u32) };
+    if magic != DIRIDX_MAGIC {
+        return None;
+    }
+
+    // generation at offset 8 (see DirIndexHeader layout)
+    let gen_ptr = unsafe { &*((mmap_ptr as usize + 8) as *const AtomicU64) };
+    let dir_hash = vrift_ipc::fnv1a_hash(dir_key);
+
+    let mut spins: u32 = 0;
+    loop {
+        let g1 = gen_ptr.load(Ordering::Acquire);
+        if g1 & 1 != 0 {
+            // vDird is rebuilding the index — bounded spin
+            spins += 1;
+            if spins > MAX_SEQLOCK_SPINS {
+                return None;
+            }
+            core::hint::spin_loop();
+            continue;
+        }
+
+        // Freshness: index must match the live VDir snapshot exactly
+        let built_from = unsafe { *((mmap_ptr as usize + 16) as *const u64) };
+        if built_from != live_vdir_generation {
+            return None;
+        }
+
+        let table_capacity = unsafe { *((mmap_ptr as usize + 28) as *const u32) } as usize;
+        let table_offset = unsafe { *((mmap_ptr as usize + 32) as *const u32) } as usize;
+        let pool_offset = unsafe { *((mmap_ptr as usize + 36) as *const u32) } as usize;
+        let pool_size = unsafe { *((mmap_ptr as usize + 40) as *const u32) } as usize;
+
+        // The file may have grown past our mapping (vDird rebuild) — fall back
+        if table_capacity == 0
+            || table_offset + table_capacity * DIRIDX_SLOT_SIZE > mmap_size
+            || pool_offset + pool_size > mmap_size
+        {
+            return None;
+        }
+
+        // O(1) slot lookup with linear probing
+        let start = (dir_hash as usize) % table_capacity;
+        let mut result: Option<Vec<vrift_ipc::DirEntry>> = None;
+        for i in 0..table_capacity {
+            let slot_idx = (start + i) % table_capacity;
+            let slot = unsafe {
+                &*(mmap_ptr.add(table_offset + slot_idx * DIRIDX_SLOT_SIZE) as *const DirIndexSlot)
+            };
+            if slot.is_empty() {
+                break; // Empty slot = directory not indexed
+            }
+            if slot.dir_hash != dir_hash {
+                continue;
+            }
+
+            let base = pool_offset + slot.children_offset as usize;
+            if base + slot.children_bytes as usize > mmap_size {
+                return None;
+            }
+            let mut entries = Vec::with_capacity(slot.children_count as usize);
+            let mut cursor = 0usize;
+            let mut valid = true;
+            for _ in 0..slot.children_count {
+                if cursor + DIRIDX_CHILD_HEADER_SIZE > slot.children_bytes as usize {
+                    valid = false;
+                    break;
+                }
+                let child =
+                    unsafe { &*(mmap_ptr.add(base + cursor) as *const DirIndexChild) };
+                let name_start = base + cursor + DIRIDX_CHILD_HEADER_SIZE;
+                let name_len = child.name_len as usize;
+                if name_start + name_len > mmap_size {
+                    valid = false;
+                    break;
+                }
+                let name_bytes =
+                    unsafe { std::slice::from_raw_parts(mmap_ptr.add(name_start), name_len) };
+                match std::str::from_utf8(name_bytes) {
+                    Ok(name) => entries.push(vrift_ipc::DirEntry {
+                        name: name.to_string(),
+                        is_dir: child.d_type == DIRIDX_DT_DIR,
+                    }),
+                    Err(_) => {
+                        valid = false;
+                        break;
+                    }
+                }
+                cursor += vrift_ipc::vdir_types::diridx_child_record_len(name_len);
+            }
+            if valid {
+                result = Some(entries);
+            }
+            break;
+        }
+
+        // Re-read generation to detect a concurrent rebuild
+        let g2 = gen_ptr.load(Ordering::Acquire);
+        if g1 != g2 {
+            spins += 1;
+            if spins > MAX_SEQLOCK_SPINS {
+                return None;
+            }
+            core::hint::spin_loop();
+            continue;
+        }
+
+        return result;
+    }
+}
+
+/// Read the current VDir seqlock generation (even = stable snapshot).
+/// Returns None if the mmap is absent/invalid or a writer is active
+/// (odd generation) — callers should skip negative caching in that case.
+#[inline(always)]
+pub(crate) fn vdir_generation(mmap_ptr: *const u8, mmap_size: usize) -> Option<u64> {
+    if mmap_ptr.is_null() || mmap_size < VDIR_HEADER_SIZE {
+        return None;
+    }
+    let magic = unsafe { *(mmap_ptr as *const u32) };
+    if magic != VDIR_MAGIC {
+        return None;
+    }
+    // generation is at offset 8 (after magic:u32 + version:u32)
+    let gen_ptr = unsafe { &*((mmap_ptr as usize + 8) as *const AtomicU64) };
+    let generation = gen_ptr.load(Ordering::Acquire);
+    if generation & 1 != 0 {
+        return None;
+    }
+    Some(generation)
+}
+
 /// O(1) seqlock-protected stat lookup from VDir MAP_SHARED mmap.
 /// ZERO ALLOCATIONS, ZERO LOCKS, ZERO SYSCALLS — safe for PSFS hot path.
 #[inline(always)]
@@ -928,7 +1379,7 @@ pub(crate) struct InceptionLayerState {
     pub path_resolver: PathResolver,
     pub cached_soft_limit: AtomicUsize,
     pub last_usage_alert: std::sync::atomic::AtomicU64,
-    pub tasks: &'static crate::sync::RingBuffer,
+    pub tasks: &'static crate::sync::RingSet,
 }
 
 impl InceptionLayerState {
@@ -1055,7 +1506,13 @@ impl InceptionLayerState {
 
     /// Resolve an incoming path into a VfsPath if it belongs to the VFS.
     pub(crate) fn resolve_path(&self, path: &str) -> Option<VfsPath> {
-        self.path_resolver.resolve(path)
+        let resolved = self.path_resolver.resolve(path);
+        crate::stats::bump(if resolved.is_some() {
+            crate::stats::CTR_RESOLVE_VFS
+        } else {
+            crate::stats::CTR_RESOLVE_PASSTHROUGH
+        });
+        resolved
     }
 
     /// Check if path is in VFS domain
@@ -1153,7 +1610,17 @@ impl InceptionLayerState {
     /// Query daemon for directory listing (for opendir/readdir)
     #[allow(dead_code)]
     pub(crate) fn query_dir_listing(&self, path: &str) -> Option<Vec<vrift_ipc::DirEntry>> {
-        // Fall back to IPC (readdir is not on the PSFS hot path and VDir doesn't store filenames)
+        // Try the precomputed mmap dir index first: children laid out
+        // contiguously per directory, sorted — one scan, no IPC.
+        if let Some(vpath) = self.resolve_path(path) {
+            if let Some(live_generation) = vdir_generation(self.mmap_ptr, self.mmap_size) {
+                if let Some(entries) = diridx_list(vpath.manifest_key.as_str(), live_generation) {
+                    return Some(entries);
+                }
+            }
+        }
+
+        // Fall back to IPC (index absent/stale, or VDir doesn't store filenames)
         unsafe { sync_ipc_manifest_list_dir(&self.vdird_socket_path, path) }
     }
 
@@ -1487,6 +1954,40 @@ mod dirty_tracker_tests {
         }
     }
 
+    #[test]
+    fn test_temp_path_publication() {
+        let tracker = DirtyTracker::new();
+
+        // No entry yet - publication is a no-op
+        tracker.set_temp_path("src/main.rs", "/proj/.vrift/staging/x.tmp");
+        assert!(tracker.temp_path_for("src/main.rs").is_none());
+
+        tracker.mark_dirty("src/main.rs");
+        // Marked but not yet published
+        assert!(tracker.temp_path_for("src/main.rs").is_none());
+
+        tracker.set_temp_path("src/main.rs", "/proj/.vrift/staging/x.tmp");
+        let temp = tracker.temp_path_for("src/main.rs").unwrap();
+        assert_eq!(temp.as_str(), "/proj/.vrift/staging/x.tmp");
+
+        // Clearing drops the published path along with the dirty bit
+        tracker.clear_dirty("src/main.rs");
+        assert!(tracker.temp_path_for("src/main.rs").is_none());
+    }
+
+    #[test]
+    fn test_temp_path_not_leaked_across_occupants() {
+        let tracker = DirtyTracker::new();
+        tracker.mark_dirty("file_a.rs");
+        tracker.set_temp_path("file_a.rs", "/proj/.vrift/staging/a.tmp");
+        tracker.clear_dirty("file_a.rs");
+
+        // Re-marking (likely reusing the tombstoned slot) must not expose
+        // the previous occupant's staging path.
+        tracker.mark_dirty("file_a.rs");
+        assert!(tracker.temp_path_for("file_a.rs").is_none());
+    }
+
     #[test]
     #[allow(clippy::unwrap_used)]
     fn test_concurrent_mark_dirty() {
@@ -2,11 +2,14 @@
 // state/worker.rs — Background worker thread
 // =============================================================================
 //
-// Manages the background worker thread that processes tasks from the ring buffer.
+// Manages the background worker pool that processes tasks from the ring set.
 // Includes:
 //   - spawn_worker()  — #[inline(never)] to isolate pthread_create side effects
 //   - worker_entry()  — adaptive backoff loop (spin → yield → sleep)
 //   - process_task()  — dispatch ring buffer tasks
+//
+// NUM_WORKERS threads each own a home ring in the RingSet and steal batches
+// from the others when their own runs dry (see sync/ring_buffer.rs).
 // =============================================================================
 
 use std::sync::atomic::Ordering;
@@ -24,18 +27,21 @@ impl InceptionLayerState {
         }
 
         unsafe {
-            let mut thread: libc::pthread_t = std::mem::zeroed();
-            libc::pthread_create(
-                &mut thread,
-                std::ptr::null(),
-                Self::worker_entry,
-                std::ptr::null_mut(),
-            );
-            libc::pthread_detach(thread);
+            for worker_id in 0..crate::sync::NUM_WORKERS {
+                let mut thread: libc::pthread_t = std::mem::zeroed();
+                // Worker id travels in the arg pointer — no allocation needed
+                libc::pthread_create(
+                    &mut thread,
+                    std::ptr::null(),
+                    Self::worker_entry,
+                    worker_id as *mut libc::c_void,
+                );
+                libc::pthread_detach(thread);
+            }
         }
     }
 
-    extern "C" fn worker_entry(_: *mut libc::c_void) -> *mut libc::c_void {
+    extern "C" fn worker_entry(arg: *mut libc::c_void) -> *mut libc::c_void {
         // Block all signals in worker thread
         unsafe {
             let mut mask: libc::sigset_t = std::mem::zeroed();
@@ -43,18 +49,24 @@ impl InceptionLayerState {
             libc::pthread_sigmask(libc::SIG_BLOCK, &mask, std::ptr::null_mut());
         }
 
+        let worker_id = arg as usize;
+
         let reactor = match crate::sync::get_reactor() {
             Some(r) => r,
             None => return std::ptr::null_mut(),
         };
 
-        // Worker thread loop with adaptive backoff for CPU efficiency
+        // Worker thread loop with adaptive backoff for CPU efficiency.
+        // Drains the home ring first, steals batches from siblings when idle.
         let mut backoff_count = 0u32;
+        let mut batch: Vec<crate::sync::Task> = Vec::with_capacity(64);
         loop {
-            if let Some(task) = reactor.ring_buffer.pop() {
+            if reactor.ring_buffer.pop_batch_for(worker_id, &mut batch, 64) > 0 {
                 // Reset backoff on success
                 backoff_count = 0;
-                Self::process_task(task);
+                for task in batch.drain(..) {
+                    Self::process_task(task);
+                }
             } else {
                 // No task available - adaptive backoff
                 backoff_count = backoff_count.saturating_add(1).min(1000);
@@ -0,0 +1,189 @@
+// =============================================================================
+// stats.rs — Always-on hot-path performance counters
+// =============================================================================
+//
+// Every interception family bumps a counter on its hot path: a single
+// relaxed fetch_add on a cache-line-padded stripe chosen from the calling
+// thread's identity (no TLS — stripe selection must work during dyld
+// bootstrap, Pattern 2648/2649). Counters start in a process-local static
+// page so recording is valid from the first interposed syscall; cold init
+// publishes them into a shared-memory page under
+// <project_root>/.vrift/stats/ that `vrift stats` samples live.
+//
+// BUG-007b note: publish_stats_page runs inside state init, so all file I/O
+// here is raw syscalls only (open/ftruncate/mmap are interposed).
+
+use std::sync::atomic::{AtomicUsize, Ordering};
+
+use vrift_ipc::stats_page::StatsPage;
+pub use vrift_ipc::stats_page::{
+    CTR_COW, CTR_DIRTY_BYPASS, CTR_IPC_FAIL, CTR_IPC_ROUNDTRIP, CTR_MMAP_BLOB, CTR_OPEN_HIT,
+    CTR_OPEN_MISS, CTR_REINGEST, CTR_RESOLVE_PASSTHROUGH, CTR_RESOLVE_VFS, CTR_RING_LOOKUP,
+    CTR_STAT_HIT, CTR_STAT_MISS, CTR_WORKER_POP, CTR_WORKER_PUSH,
+};
+
+/// Process-local fallback page: always valid, so `bump` never branches on
+/// initialization state. Folded into the shared page when it is published.
+static LOCAL_PAGE: StatsPage = StatsPage::new();
+
+/// Published shared-memory page, or 0 while (or if) none exists.
+static STATS_PTR: AtomicUsize = AtomicUsize::new(0);
+
+#[inline(always)]
+fn page() -> &'static StatsPage {
+    let ptr = STATS_PTR.load(Ordering::Relaxed);
+    if ptr == 0 {
+        &LOCAL_PAGE
+    } else {
+        // Safety: only publish_stats_page stores here, and only after
+        // validating a mapping that lives for the process lifetime.
+        unsafe { &*(ptr as *const StatsPage) }
+    }
+}
+
+/// Stripe index from the thread's pthread handle. Fibonacci hash of a
+/// stable per-thread value — no TLS, a few ALU ops.
+#[inline(always)]
+fn stripe_idx() -> usize {
+    let tid = unsafe { libc::pthread_self() } as usize;
+    (tid.wrapping_mul(0x9E37_79B9_7F4A_7C15) >> 56) as usize
+}
+
+/// The counting primitive: one relaxed increment, always valid to call.
+#[inline(always)]
+pub fn bump(counter: usize) {
+    page().bump(stripe_idx(), counter);
+}
+
+/// Counter mapping for flight-recorder events, so every existing
+/// `inception_record!` site feeds the stats page for free.
+#[inline(always)]
+pub fn bump_event(event: crate::state::EventType) {
+    use crate::state::EventType;
+    let counter = match event {
+        EventType::OpenHit => CTR_OPEN_HIT,
+        EventType::OpenMiss => CTR_OPEN_MISS,
+        EventType::StatHit => CTR_STAT_HIT,
+        EventType::StatMiss => CTR_STAT_MISS,
+        EventType::CowTriggered => CTR_COW,
+        EventType::IpcFail => CTR_IPC_FAIL,
+        EventType::IpcSuccess => CTR_IPC_ROUNDTRIP,
+        EventType::ReingestSuccess => CTR_REINGEST,
+        _ => return,
+    };
+    bump(counter);
+}
+
+/// Map `<project_root>/.vrift/stats/shim_<pid>.stats` read-write and swing
+/// STATS_PTR to it. Failure is non-fatal: counts keep accumulating in the
+/// local page, they just are not visible to `vrift stats`.
+pub(crate) unsafe fn publish_stats_page(project_root: &str) {
+    use std::fmt::Write;
+
+    if project_root.is_empty() {
+        return;
+    }
+
+    let pid = libc::getpid() as u32;
+
+    // Build paths in a stack buffer (no heap during init)
+    let mut dir_buf = [0u8; 1024];
+    let mut writer = crate::macros::StackWriter::new(&mut dir_buf);
+    if write!(writer, "{}/.vrift/stats\0", project_root).is_err() {
+        return;
+    }
+    let dir_ptr = dir_buf.as_ptr() as *const libc::c_char;
+    #[cfg(target_os = "macos")]
+    crate::syscalls::macos_raw::raw_mkdir(dir_ptr, 0o755);
+    #[cfg(target_os = "linux")]
+    crate::syscalls::linux_raw::raw_mkdir(dir_ptr, 0o755);
+
+    let mut path_buf = [0u8; 1024];
+    let mut writer = crate::macros::StackWriter::new(&mut path_buf);
+    if write!(
+        writer,
+        "{}/.vrift/stats/shim_{}.stats\0",
+        project_root, pid
+    )
+    .is_err()
+    {
+        return;
+    }
+    let path_ptr = path_buf.as_ptr() as *const libc::c_char;
+
+    #[cfg(target_os = "macos")]
+    let fd = crate::syscalls::macos_raw::raw_open(
+        path_ptr,
+        libc::O_RDWR | libc::O_CREAT | libc::O_TRUNC | libc::O_CLOEXEC,
+        0o644,
+    );
+    #[cfg(target_os = "linux")]
+    let fd = crate::syscalls::linux_raw::raw_openat(
+        libc::AT_FDCWD,
+        path_ptr,
+        libc::O_RDWR | libc::O_CREAT | libc::O_TRUNC | libc::O_CLOEXEC,
+        0o644,
+    );
+    if fd < 0 {
+        return;
+    }
+
+    #[cfg(target_os = "macos")]
+    let trunc = crate::syscalls::macos_raw::raw_ftruncate(fd, StatsPage::SIZE as libc::off_t);
+    #[cfg(target_os = "linux")]
+    let trunc = crate::syscalls::linux_raw::raw_ftruncate(fd, StatsPage::SIZE as libc::off_t);
+
+    let map = if trunc == 0 {
+        #[cfg(target_os = "macos")]
+        {
+            crate::syscalls::macos_raw::raw_mmap(
+                std::ptr::null_mut(),
+                StatsPage::SIZE,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_SHARED,
+                fd,
+                0,
+            )
+        }
+        #[cfg(target_os = "linux")]
+        {
+            crate::syscalls::linux_raw::raw_mmap(
+                std::ptr::null_mut(),
+                StatsPage::SIZE,
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_SHARED,
+                fd,
+                0,
+            )
+        }
+    } else {
+        libc::MAP_FAILED
+    };
+
+    #[cfg(target_os = "macos")]
+    crate::syscalls::macos_raw::raw_close(fd);
+    #[cfg(target_os = "linux")]
+    crate::syscalls::linux_raw::raw_close(fd);
+
+    if map == libc::MAP_FAILED || map as usize % 64 != 0 {
+        return;
+    }
+
+    // The file is zero-filled; fold in whatever the local page counted
+    // before publish so early events are not lost.
+    let shared = &*(map as *const StatsPage);
+    for counter in 0..vrift_ipc::stats_page::COUNTER_COUNT {
+        let early = LOCAL_PAGE.total(counter);
+        if early > 0 {
+            shared.stripes[0].counters[counter].fetch_add(early, Ordering::Relaxed);
+        }
+    }
+
+    let start = std::time::SystemTime::now()
+        .duration_since(std::time::UNIX_EPOCH)
+        .map(|d| d.as_secs())
+        .unwrap_or(0);
+    shared.publish_header(pid, start);
+
+    STATS_PTR.store(map as usize, Ordering::Release);
+}
@@ -1,6 +1,6 @@
 use crate::syscalls::io::FdEntry;
 use std::ptr;
-use std::sync::atomic::{AtomicPtr, Ordering};
+use std::sync::atomic::{AtomicPtr, AtomicUsize, Ordering};
 
 // RFC-0051: Flat atomic array for lock-free FD tracking
 // Direct indexing for maximum performance (eliminates one indirection)
@@ -8,19 +8,45 @@ const TIER1_SIZE: usize = 256;
 const TIER2_SIZE: usize = 1024;
 pub const MAX_FDS: usize = TIER1_SIZE * TIER2_SIZE; // 262,144 FDs
 
+/// Pointers per 64-byte cache line (AtomicPtr is 8 bytes)
+const SLOTS_PER_LINE: usize = 8;
+
 /// A tiered atomic array for wait-free FD tracking.
 /// Supports up to 262,144 FDs with lazy tier-2 allocation.
+///
+/// Each tier-2 chunk acts as a shard: it carries its own cache-line-padded
+/// live-entry counter so `for_each` can skip empty shards outright, and fd
+/// slots are striped across cache lines within a shard so consecutive fds
+/// (the common allocation pattern) never contend on the same line.
 #[repr(align(64))]
 pub struct FdTable {
     // Level 1: Sparse array of chunks
     table: [AtomicPtr<Tier2>; TIER1_SIZE],
+    /// High-water mark of allocated tier-1 indices (exclusive bound for scans)
+    tier1_high_water: AtomicUsize,
 }
 
+/// Live-entry counter on its own cache line, so set/remove bookkeeping in one
+/// shard never ping-pongs with slot accesses or with other shards' counters.
+#[repr(align(64))]
+struct PaddedCount(AtomicUsize);
+
 #[repr(align(64))]
 struct Tier2 {
+    /// Number of non-null entries in this shard
+    live: PaddedCount,
     entries: [AtomicPtr<FdEntry>; TIER2_SIZE],
 }
 
+/// Stripe consecutive fds across cache lines within a shard.
+///
+/// The low 3 bits select the line group and the remaining bits the offset,
+/// so fd and fd+1 land 128 slots (16 lines) apart. Bijective on 0..TIER2_SIZE.
+#[inline(always)]
+fn stripe(i2: usize) -> usize {
+    ((i2 & (SLOTS_PER_LINE - 1)) * (TIER2_SIZE / SLOTS_PER_LINE)) | (i2 / SLOTS_PER_LINE)
+}
+
 impl Default for FdTable {
     fn default() -> Self {
         Self::new()
@@ -31,6 +57,7 @@ impl FdTable {
     pub fn new() -> Self {
         Self {
             table: [const { AtomicPtr::new(ptr::null_mut()) }; TIER1_SIZE],
+            tier1_high_water: AtomicUsize::new(0),
         }
     }
 
@@ -43,12 +70,13 @@ impl FdTable {
         }
 
         let i1 = fd / TIER2_SIZE;
-        let i2 = fd % TIER2_SIZE;
+        let i2 = stripe(fd % TIER2_SIZE);
 
         let mut tier2_ptr = self.table[i1].load(Ordering::Acquire);
         if tier2_ptr.is_null() {
             // Lazy allocation of the second tier
             let new_tier = Box::into_raw(Box::new(Tier2 {
+                live: PaddedCount(AtomicUsize::new(0)),
                 entries: [const { AtomicPtr::new(ptr::null_mut()) }; TIER2_SIZE],
             }));
 
@@ -60,6 +88,8 @@ impl FdTable {
             ) {
                 Ok(_) => {
                     tier2_ptr = new_tier;
+                    // Monotonic raise of the scan bound
+                    self.tier1_high_water.fetch_max(i1 + 1, Ordering::AcqRel);
                 }
                 Err(existing) => {
                     // Someone else initialized it
@@ -69,7 +99,17 @@ impl FdTable {
             }
         }
 
-        unsafe { (&*tier2_ptr).entries[i2].swap(entry, Ordering::AcqRel) }
+        let tier2 = unsafe { &*tier2_ptr };
+        let old = tier2.entries[i2].swap(entry, Ordering::AcqRel);
+
+        // Shard bookkeeping: count null <-> non-null transitions
+        if old.is_null() && !entry.is_null() {
+            tier2.live.0.fetch_add(1, Ordering::AcqRel);
+        } else if !old.is_null() && entry.is_null() {
+            tier2.live.0.fetch_sub(1, Ordering::AcqRel);
+        }
+
+        old
     }
 
     /// Get the entry for a given FD.
@@ -81,7 +121,7 @@ impl FdTable {
         }
 
         let i1 = fd / TIER2_SIZE;
-        let i2 = fd % TIER2_SIZE;
+        let i2 = stripe(fd % TIER2_SIZE);
 
         // Use Relaxed for reads - we don't need synchronization for lookups
         let tier2_ptr = self.table[i1].load(Ordering::Relaxed);
@@ -99,17 +139,30 @@ impl FdTable {
     }
 
     /// Scan all entries in the table.
+    ///
+    /// Wait-free: no locks, never blocks writers. Shards with a zero live
+    /// count are skipped entirely, so the cost is proportional to shards that
+    /// actually hold open fds — this sits on the stat dirty-check path via
+    /// `find_live_temp_path()`, where a full 262k-slot walk used to hurt.
     pub fn for_each<F>(&self, mut f: F)
     where
         F: FnMut(&FdEntry),
     {
-        for i1 in 0..TIER1_SIZE {
+        let bound = self
+            .tier1_high_water
+            .load(Ordering::Acquire)
+            .min(TIER1_SIZE);
+        for i1 in 0..bound {
             let tier2_ptr = self.table[i1].load(Ordering::Relaxed);
             if tier2_ptr.is_null() {
                 continue;
             }
+            let tier2 = unsafe { &*tier2_ptr };
+            if tier2.live.0.load(Ordering::Acquire) == 0 {
+                continue; // Empty shard — skip 1024 slot loads
+            }
             for i2 in 0..TIER2_SIZE {
-                let entry_ptr = unsafe { (&*tier2_ptr).entries[i2].load(Ordering::Relaxed) };
+                let entry_ptr = tier2.entries[i2].load(Ordering::Relaxed);
                 if !entry_ptr.is_null() {
                     unsafe { f(&*entry_ptr) };
                 }
@@ -4,7 +4,7 @@ pub mod ring_buffer;
 
 pub use fd_table::FdTable;
 pub use recursive_mutex::RecursiveMutex;
-pub use ring_buffer::{RingBuffer, Task};
+pub use ring_buffer::{RingBuffer, RingSet, Task, NUM_WORKERS};
 
 use std::cell::UnsafeCell;
 use std::sync::atomic::AtomicBool;
@@ -12,7 +12,7 @@ use std::sync::atomic::AtomicBool;
 /// Global Reactor State
 pub struct Reactor {
     pub fd_table: FdTable,
-    pub ring_buffer: RingBuffer,
+    pub ring_buffer: RingSet,
     pub started: AtomicBool,
 }
 
@@ -1,5 +1,5 @@
 use std::cell::UnsafeCell;
-use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::sync::atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering};
 
 // Force 128-byte alignment to prevent false sharing across NUMA nodes
 // Modern CPUs prefetch adjacent cache lines, so we use double cache line size
@@ -24,8 +24,9 @@ pub enum Task {
     },
 }
 
-// Power of 2 for fast modulo via bitwise AND
-const BUFFER_SIZE: usize = 4096;
+// Power of 2 for fast modulo via bitwise AND.
+// Per-ring capacity: NUM_RINGS rings together keep the old 4096-slot total.
+const BUFFER_SIZE: usize = 1024;
 const BUFFER_MASK: usize = BUFFER_SIZE - 1;
 
 /// Performance statistics for monitoring
@@ -34,6 +35,8 @@ pub struct RingBufferStats {
     pub pops: AtomicU64,
     pub push_errors: AtomicU64,
     pub max_depth: AtomicU64,
+    /// Tasks drained from this ring by a worker other than its home worker
+    pub steals: AtomicU64,
 }
 
 impl RingBufferStats {
@@ -43,6 +46,7 @@ impl RingBufferStats {
             pops: AtomicU64::new(0),
             push_errors: AtomicU64::new(0),
             max_depth: AtomicU64::new(0),
+            steals: AtomicU64::new(0),
         }
     }
 }
@@ -124,6 +128,7 @@ impl RingBuffer {
 
                     // Update statistics
                     self.stats.0.pushes.fetch_add(1, Ordering::Relaxed);
+                    crate::stats::bump(crate::stats::CTR_WORKER_PUSH);
                     let depth = head.wrapping_sub(tail) + 1;
                     self.stats
                         .0
@@ -159,6 +164,7 @@ impl RingBuffer {
             if let Some(task) = task {
                 self.tail.0.store(tail.wrapping_add(1), Ordering::Release);
                 self.stats.0.pops.fetch_add(1, Ordering::Relaxed);
+                crate::stats::bump(crate::stats::CTR_WORKER_POP);
                 return Some(task);
             }
             core::hint::spin_loop();
@@ -172,13 +178,14 @@ impl RingBuffer {
         head.wrapping_sub(tail)
     }
 
-    /// Get performance statistics
-    pub fn stats(&self) -> (u64, u64, u64, u64) {
+    /// Get performance statistics: (pushes, pops, push_errors, max_depth, steals)
+    pub fn stats(&self) -> (u64, u64, u64, u64, u64) {
         (
             self.stats.0.pushes.load(Ordering::Relaxed),
             self.stats.0.pops.load(Ordering::Relaxed),
             self.stats.0.push_errors.load(Ordering::Relaxed),
             self.stats.0.max_depth.load(Ordering::Relaxed),
+            self.stats.0.steals.load(Ordering::Relaxed),
         )
     }
 
@@ -211,6 +218,110 @@ impl RingBuffer {
     }
 }
 
+// Power of 2 so the home-ring index is a masked hash
+pub const NUM_RINGS: usize = 4;
+const RING_MASK: usize = NUM_RINGS - 1;
+
+/// Worker threads draining a RingSet
+pub const NUM_WORKERS: usize = 2;
+
+/// Multiple MPSC rings with a work-stealing consumer pool.
+///
+/// Producers hash their thread onto a home ring (spilling to the next ring
+/// when full), so ingest notifications from many threads no longer serialize
+/// through one queue. Each worker drains its own ring first and steals
+/// batches from the others; since `pop`/`pop_batch` are single-consumer, a
+/// per-ring consumer try-lock keeps exactly one worker on a ring at a time —
+/// workers never block, they just move to the next ring on contention.
+pub struct RingSet {
+    rings: [RingBuffer; NUM_RINGS],
+    consumer_locks: [CachePadded<AtomicBool>; NUM_RINGS],
+}
+
+impl Default for RingSet {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl RingSet {
+    #[allow(clippy::large_stack_frames)] // const fn for static init — never on runtime stack
+    pub const fn new() -> Self {
+        Self {
+            rings: [const { RingBuffer::new() }; NUM_RINGS],
+            consumer_locks: [const { CachePadded(AtomicBool::new(false)) }; NUM_RINGS],
+        }
+    }
+
+    /// Home ring for the calling thread. Fibonacci hash of pthread_self —
+    /// a TLS register read on both platforms, safe in interposed handlers.
+    #[inline(always)]
+    fn home_index() -> usize {
+        let tid = unsafe { libc::pthread_self() } as usize;
+        // Drop allocator-alignment low bits, mix, take the top bits
+        let mixed = (tid >> 12).wrapping_mul(0x9E37_79B9_7F4A_7C15);
+        (mixed >> (usize::BITS as usize - NUM_RINGS.trailing_zeros() as usize)) & RING_MASK
+    }
+
+    /// Push to the calling thread's home ring, spilling to the next rings
+    /// when full. Returns Err only when every ring is full.
+    #[inline(always)]
+    pub fn push(&self, task: Task) -> Result<(), Task> {
+        let home = Self::home_index();
+        let mut task = task;
+        for i in 0..NUM_RINGS {
+            match self.rings[(home + i) & RING_MASK].push(task) {
+                Ok(()) => return Ok(()),
+                Err(t) => task = t,
+            }
+        }
+        Err(task)
+    }
+
+    /// Drain a batch for worker `worker_id`: home ring first, then steal from
+    /// the others. Steals are recorded on the victim ring's counters.
+    /// Never blocks — rings whose consumer lock is held are skipped.
+    pub fn pop_batch_for(&self, worker_id: usize, batch: &mut Vec<Task>, max: usize) -> usize {
+        let home = worker_id & RING_MASK;
+        let mut total = 0;
+        for i in 0..NUM_RINGS {
+            let idx = (home + i) & RING_MASK;
+            let ring = &self.rings[idx];
+            if ring.depth() == 0 {
+                continue;
+            }
+            // Single-consumer invariant: only the lock holder may pop
+            if self.consumer_locks[idx]
+                .0
+                .compare_exchange(false, true, Ordering::Acquire, Ordering::Relaxed)
+                .is_err()
+            {
+                continue;
+            }
+            let n = ring.pop_batch(batch, max - total);
+            self.consumer_locks[idx].0.store(false, Ordering::Release);
+            if i > 0 && n > 0 {
+                ring.stats.0.steals.fetch_add(n as u64, Ordering::Relaxed);
+            }
+            total += n;
+            if total >= max {
+                break;
+            }
+        }
+        total
+    }
+
+    /// Total depth across all rings
+    pub fn depth(&self) -> usize {
+        self.rings.iter().map(|r| r.depth()).sum()
+    }
+
+    /// Per-ring statistics: (pushes, pops, push_errors, max_depth, steals)
+    pub fn ring_stats(&self, ring: usize) -> (u64, u64, u64, u64, u64) {
+        self.rings[ring & RING_MASK].stats()
+    }
+}
+
 /// Helper for static initialization
 pub struct RingBufferStore {
     inner: UnsafeCell<Option<RingBuffer>>,
@@ -1,5 +1,118 @@
 use libc::{c_int, c_void, off_t, size_t};
 
+#[cfg(target_os = "linux")]
+use crate::syscalls::linux_raw::{raw_close, raw_mmap, raw_open};
+#[cfg(target_os = "macos")]
+use crate::syscalls::macos_raw::{raw_close, raw_mmap, raw_open};
+
+/// Map a read-only VFS mapping straight from the CAS blob.
+///
+/// Linkers consume .o files and dynamic loaders consume .so files through
+/// PROT_READ (±PROT_EXEC) mappings. When the caller's fd is a tracked VFS
+/// file, remapping from the blob means N concurrent consumers of the same
+/// library share ONE page-cache copy, regardless of how each of them
+/// reached the file (blob redirect, hardlink projection, pre-init open).
+/// Mapping the blob by path is idempotent when the fd already points at
+/// it — same inode, same pages.
+///
+/// Returns None (fall back to the caller's fd) for anything that could
+/// observe writes: PROT_WRITE mappings, CoW-staged fds, dirty paths.
+unsafe fn try_map_blob(
+    addr: *mut c_void,
+    len: size_t,
+    prot: c_int,
+    flags: c_int,
+    fd: c_int,
+    offset: off_t,
+) -> Option<*mut c_void> {
+    use std::fmt::Write;
+
+    // File-backed, read-only mappings only. A PROT_WRITE MAP_SHARED
+    // mapping must stay on the caller's fd or stores would land in the
+    // blob; MAP_PRIVATE+PROT_WRITE is technically safe but rare enough
+    // that it isn't worth the lookup.
+    if fd < 0 || (prot & libc::PROT_WRITE) != 0 || (flags & libc::MAP_ANON) != 0 {
+        return None;
+    }
+
+    let entry = crate::syscalls::io::get_fd_entry(fd)?;
+    if !entry.is_vfs || !entry.temp_path.as_str().is_empty() {
+        return None; // CoW staging fds map their own temp file
+    }
+
+    let state = crate::state::InceptionLayerState::get()?;
+    if crate::state::DIRTY_TRACKER.is_dirty(entry.manifest_key.as_str()) {
+        return None; // Pending writes — the blob is stale for this path
+    }
+
+    // Guard against re-entrancy (the IPC below may fault or log)
+    let _guard = crate::state::InceptionLayerGuard::enter()?;
+
+    let vnode = crate::ipc::sync_ipc_manifest_get(
+        &state.vdird_socket_path,
+        entry.manifest_key.as_str(),
+    )?;
+
+    // BUG-007b: stack-built path + raw syscalls only — no heap, no libc
+    // wrappers in interposed context
+    const HEX_CHARS: &[u8; 16] = b"0123456789abcdef";
+    let mut hex = [0u8; 64];
+    for (i, byte) in vnode.content_hash.iter().enumerate() {
+        hex[i * 2] = HEX_CHARS[(byte >> 4) as usize];
+        hex[i * 2 + 1] = HEX_CHARS[(byte & 0x0f) as usize];
+    }
+    let hash_hex = core::str::from_utf8_unchecked(&hex);
+
+    // Ingest writes `{hash}_{size}.bin`, but CasStore::store/store_by_move
+    // (the daemon reingest path for modified files) write `{hash}_{size}`
+    // with no extension — probe both so reingested files get the same
+    // zero-copy path.
+    let mut blob_fd = -1;
+    for suffix in [".bin", ""] {
+        let mut buf = [0u8; 1024];
+        let mut writer = crate::macros::StackWriter::new(&mut buf);
+        write!(
+            writer,
+            "{}/blake3/{}/{}/{}_{}{}\0",
+            state.cas_root,
+            &hash_hex[0..2],
+            &hash_hex[2..4],
+            hash_hex,
+            vnode.size,
+            suffix
+        )
+        .ok()?;
+
+        blob_fd = raw_open(
+            writer.as_str().as_ptr() as *const libc::c_char,
+            libc::O_RDONLY | libc::O_CLOEXEC,
+            0,
+        );
+        if blob_fd >= 0 {
+            break;
+        }
+    }
+    if blob_fd < 0 {
+        return None; // Compressed/chunked tier or missing — keep caller's fd
+    }
+
+    let mapped = raw_mmap(addr, len, prot, flags, blob_fd, offset);
+    raw_close(blob_fd);
+    // Raw syscall error convention: MAP_FAILED from the wrapper, or a
+    // negative-errno "address" straight from the kernel
+    if mapped == libc::MAP_FAILED || (mapped as isize) < 0 {
+        return None;
+    }
+
+    inception_log!(
+        "mmap '{}' served from blob (len={})",
+        entry.manifest_key.as_str(),
+        len
+    );
+    crate::stats::bump(crate::stats::CTR_MMAP_BLOB);
+    Some(mapped)
+}
+
 #[no_mangle]
 pub unsafe extern "C" fn mmap_inception(
     addr: *mut c_void,
@@ -9,12 +122,19 @@ pub unsafe extern "C" fn mmap_inception(
     fd: c_int,
     offset: off_t,
 ) -> *mut c_void {
+    // Zero-copy fast path: read-only mappings of VFS files are served
+    // from the CAS blob so concurrent consumers share one page-cache copy.
+    // Only attempted once the state is up — during __malloc_init every
+    // mapping is anonymous and falls straight through.
+    if fd >= 0 {
+        if let Some(mapped) = try_map_blob(addr, len, prot, flags, fd, offset) {
+            return mapped;
+        }
+    }
+
     // RFC-0051: Always use raw syscall for mmap to avoid any dlsym dependency.
     // mmap is called during __malloc_init before dlsym is safe.
-    #[cfg(target_os = "macos")]
-    return crate::syscalls::macos_raw::raw_mmap(addr, len, prot, flags, fd, offset);
-    #[cfg(target_os = "linux")]
-    return crate::syscalls::linux_raw::raw_mmap(addr, len, prot, flags, fd, offset);
+    raw_mmap(addr, len, prot, flags, fd, offset)
 }
 
 #[no_mangle]
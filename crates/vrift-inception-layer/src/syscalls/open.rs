@@ -192,6 +192,10 @@ pub(crate) unsafe fn open_impl(path: *const c_char, flags: c_int, mode: mode_t)
         if fd < 0 {
             None
         } else {
+            // Publish the staging path on the dirty entry so stat() can
+            // resolve it without scanning the FdTable.
+            DIRTY_TRACKER.set_temp_path(&vpath.manifest_key, temp_path.as_str());
+
             // Allocate entry manually for lock-free insertion
             let entry = Box::into_raw(Box::new(crate::syscalls::io::FdEntry {
                 vpath: vpath.absolute,
@@ -317,6 +321,11 @@ pub unsafe extern "C" fn open_inception_c_impl(p: *const c_char, f: c_int, m: mo
     if CIRCUIT_TRIPPED.load(Ordering::Relaxed) {
         return raw_open_internal(p, f, m);
     }
+    // Foreign-path fast path: out-of-domain absolute paths cost a prefix
+    // compare and the raw syscall — no resolver, no guard, no FD tracking
+    if crate::state::vr_path_foreign(p) != 0 {
+        return raw_open_internal(p, f, m);
+    }
     if !is_vfs_ready() && InceptionLayerState::get().is_none() {
         return raw_open_internal(p, f, m);
     }
@@ -52,10 +52,19 @@ unsafe fn stat_impl_common(path_str: &str, buf: *mut libc_stat) -> Option<c_int>
 
     // PSFS: hot path — zero alloc, zero lock, zero syscall. Hit/Miss recorded below.
 
+    // Generation observed BEFORE the lookups: a concurrent vDird write then
+    // invalidates any negative entry we record instead of poisoning it.
+    let mut neg_gen: Option<u64> = None;
+
     // M4: Dirty Check - if file is being written to, bypass mmap cache
     if DIRTY_TRACKER.is_dirty(manifest_path) {
-        // Try to find live metadata from open FDs
-        if let Some(temp_path) = find_live_temp_path(manifest_path) {
+        crate::stats::bump(crate::stats::CTR_DIRTY_BYPASS);
+        // The tracker publishes the staging path per entry; the FdTable scan
+        // only covers the window before the CoW fd is registered.
+        if let Some(temp_path) = DIRTY_TRACKER
+            .temp_path_for(manifest_path)
+            .or_else(|| find_live_temp_path(manifest_path))
+        {
             let temp_path_cstr = match std::ffi::CString::new(temp_path.as_str()) {
                 Ok(c) => c,
                 Err(_) => return None,
@@ -78,6 +87,8 @@ unsafe fn stat_impl_common(path_str: &str, buf: *mut libc_stat) -> Option<c_int>
         // If not found in open FDs (e.g. closed but not reingested), fall back to IPC
         // but SKIP mmap cache.
     } else {
+        neg_gen = vdir_generation(state.mmap_ptr, state.mmap_size);
+
         // Try Hot Stat Cache — Phase 1.3: seqlock-protected VDir lookup
         if let Some(entry) = vdir_lookup(state.mmap_ptr, state.mmap_size, manifest_path) {
             inception_record!(EventType::StatHit, vpath.manifest_key_hash, 11); // 11 = vdir_hit (seqlock)
@@ -99,6 +110,16 @@ unsafe fn stat_impl_common(path_str: &str, buf: *mut libc_stat) -> Option<c_int>
             // duplicate record removed — line 83 already records the vdir_hit
             return Some(0);
         }
+
+        // Negative cache: compilers probe dozens of -I include directories
+        // per header and 90%+ of those stats are ENOENT. A miss already
+        // confirmed under this VDir generation skips the IPC round trip.
+        if let Some(generation) = neg_gen {
+            if NEG_PATH_CACHE.contains(vpath.manifest_key_hash, generation) {
+                inception_record!(EventType::StatMiss, vpath.manifest_key_hash, 21); // 21 = neg_cache_hit
+                return None;
+            }
+        }
     }
 
     inception_record!(EventType::StatMiss, vpath.manifest_key_hash, 20); // 20 = vdir_miss, trying IPC
@@ -130,6 +151,12 @@ unsafe fn stat_impl_common(path_str: &str, buf: *mut libc_stat) -> Option<c_int>
         -libc::ENOENT
     );
 
+    // Confirmed miss (VDir + IPC) — remember it so the next probe is
+    // answered from L1-resident memory. neg_gen is None for dirty paths.
+    if let Some(generation) = neg_gen {
+        NEG_PATH_CACHE.insert(vpath.manifest_key_hash, generation);
+    }
+
     None
 }
 
@@ -163,7 +190,9 @@ pub unsafe extern "C" fn velo_stat_impl(path: *const c_char, buf: *mut libc_stat
 pub unsafe extern "C" fn stat_inception(path: *const c_char, buf: *mut libc_stat) -> c_int {
     // Standard interpose entry point
     let init_state = crate::state::INITIALIZING.load(std::sync::atomic::Ordering::Relaxed);
-    if init_state != 0 {
+    // Foreign-path fast path: out-of-domain absolute paths skip the
+    // resolver/guard machinery entirely (prefix compare + raw syscall)
+    if init_state != 0 || crate::state::vr_path_foreign(path) != 0 {
         #[cfg(target_os = "macos")]
         return crate::syscalls::macos_raw::raw_stat(path, buf);
         #[cfg(target_os = "linux")]
@@ -185,7 +214,7 @@ pub unsafe extern "C" fn velo_lstat_impl(path: *const c_char, buf: *mut libc_sta
 #[no_mangle]
 pub unsafe extern "C" fn lstat_inception(path: *const c_char, buf: *mut libc_stat) -> c_int {
     let init_state = crate::state::INITIALIZING.load(std::sync::atomic::Ordering::Relaxed);
-    if init_state != 0 {
+    if init_state != 0 || crate::state::vr_path_foreign(path) != 0 {
         #[cfg(target_os = "macos")]
         return crate::syscalls::macos_raw::raw_lstat(path, buf);
         #[cfg(target_os = "linux")]
@@ -319,7 +348,10 @@ pub unsafe extern "C" fn velo_access_impl(path: *const c_char, mode: c_int) -> c
 pub unsafe extern "C" fn access_inception(path: *const c_char, mode: c_int) -> c_int {
     // BUG-007: Use raw syscall during early init to avoid recursion
     let init_state = crate::state::INITIALIZING.load(std::sync::atomic::Ordering::Relaxed);
-    if init_state != 0 || crate::state::CIRCUIT_TRIPPED.load(std::sync::atomic::Ordering::Relaxed) {
+    if init_state != 0
+        || crate::state::CIRCUIT_TRIPPED.load(std::sync::atomic::Ordering::Relaxed)
+        || crate::state::vr_path_foreign(path) != 0
+    {
         #[cfg(target_os = "macos")]
         return crate::syscalls::macos_raw::raw_access(path, mode);
         #[cfg(target_os = "linux")]
@@ -0,0 +1,122 @@
+//! IPC round-trip latency microbenchmarks
+//!
+//! Measures the full socket path a shim pays per ManifestGet when the
+//! shared-memory ring is unavailable: rkyv encode, IpcHeader frame write,
+//! UDS round trip to an in-process echo daemon, and archived-view decode.
+//! The serialize-only benchmarks isolate the codec from the transport.
+//!
+//! Machine-readable results land in target/criterion/*/estimates.json;
+//! compare releases with `cargo bench -- --save-baseline <tag>`.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use std::io::{Read, Write};
+use std::os::unix::net::{UnixListener, UnixStream};
+use vrift_ipc::{IpcHeader, VeloRequest, VeloResponse, VnodeEntry};
+
+fn sample_request() -> VeloRequest {
+    VeloRequest::ManifestGet {
+        path: "src/module_42/file_42.rs".to_string(),
+    }
+}
+
+fn sample_response() -> VeloResponse {
+    VeloResponse::ManifestAck {
+        entry: Some(VnodeEntry {
+            content_hash: [0xCD; 32],
+            size: 4096,
+            mtime: 1_700_000_000,
+            mode: 0o644,
+            flags: 0,
+            _pad: 0,
+        }),
+    }
+}
+
+/// Spawn a daemon stand-in that answers every request frame with a
+/// pre-serialized ManifestAck, mirroring vDird's framing exactly.
+fn spawn_echo_daemon(socket_path: &std::path::Path) -> std::thread::JoinHandle<()> {
+    let listener = UnixListener::bind(socket_path).unwrap();
+    let reply = rkyv::to_bytes::<rkyv::rancor::Error>(&sample_response())
+        .unwrap()
+        .to_vec();
+    std::thread::spawn(move || {
+        if let Ok((mut stream, _)) = listener.accept() {
+            let mut header_buf = [0u8; IpcHeader::SIZE];
+            loop {
+                if stream.read_exact(&mut header_buf).is_err() {
+                    return;
+                }
+                let header = IpcHeader::from_bytes(&header_buf);
+                let mut payload = vec![0u8; header.length as usize];
+                if stream.read_exact(&mut payload).is_err() {
+                    return;
+                }
+                let resp_header = IpcHeader::new_response(reply.len() as u32, header.seq_id);
+                if stream.write_all(&resp_header.to_bytes()).is_err()
+                    || stream.write_all(&reply).is_err()
+                {
+                    return;
+                }
+            }
+        }
+    })
+}
+
+fn bench_ipc_roundtrip(c: &mut Criterion) {
+    let temp = tempfile::tempdir().unwrap();
+    let socket_path = temp.path().join("bench.sock");
+    let daemon = spawn_echo_daemon(&socket_path);
+
+    let mut stream = UnixStream::connect(&socket_path).unwrap();
+    let request = sample_request();
+
+    c.bench_function("ipc_manifest_get_roundtrip", |b| {
+        let mut header_buf = [0u8; IpcHeader::SIZE];
+        b.iter(|| {
+            let payload = rkyv::to_bytes::<rkyv::rancor::Error>(&request).unwrap();
+            let seq_id = vrift_ipc::next_seq_id();
+            let header = IpcHeader::new_request(payload.len() as u32, seq_id);
+            stream.write_all(&header.to_bytes()).unwrap();
+            stream.write_all(&payload).unwrap();
+
+            stream.read_exact(&mut header_buf).unwrap();
+            let resp_header = IpcHeader::from_bytes(&header_buf);
+            assert_eq!(resp_header.seq_id, seq_id);
+            let mut resp_payload = vec![0u8; resp_header.length as usize];
+            stream.read_exact(&mut resp_payload).unwrap();
+
+            // Hot-path decode: archived view, no deserialization
+            let found = match vrift_ipc::access_response(&resp_payload).unwrap() {
+                vrift_ipc::ArchivedVeloResponse::ManifestAck { entry } => entry.is_some(),
+                _ => false,
+            };
+            black_box(found)
+        })
+    });
+
+    drop(stream);
+    daemon.join().unwrap();
+}
+
+fn bench_ipc_codec(c: &mut Criterion) {
+    let request = sample_request();
+    let response_bytes = rkyv::to_bytes::<rkyv::rancor::Error>(&sample_response())
+        .unwrap()
+        .to_vec();
+
+    c.bench_function("ipc_encode_request", |b| {
+        b.iter(|| rkyv::to_bytes::<rkyv::rancor::Error>(black_box(&request)).unwrap())
+    });
+
+    c.bench_function("ipc_access_response", |b| {
+        b.iter(
+            || match vrift_ipc::access_response(black_box(&response_bytes)).unwrap() {
+                vrift_ipc::ArchivedVeloResponse::ManifestAck { entry } => entry.is_some(),
+                _ => false,
+            },
+        )
+    });
+}
+
+criterion_group!(benches, bench_ipc_roundtrip, bench_ipc_codec);
+criterion_main!(benches);
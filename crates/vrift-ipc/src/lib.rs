@@ -1,3 +1,5 @@
+pub mod shm_ring;
+pub mod stats_page;
 pub mod vdir_types;
 use rkyv::Archive;
 use serde::{Deserialize, Serialize};
@@ -306,6 +308,31 @@ pub mod frame_sync {
         }
     }
 
+    /// Read a response frame's raw payload without deserializing (skipping
+    /// heartbeats). Pair with [`access_response`] for zero-copy field reads.
+    pub fn read_response_payload<R: Read>(reader: &mut R) -> std::io::Result<(IpcHeader, Vec<u8>)> {
+        loop {
+            let header = read_header(reader)?;
+
+            // RFC-0053: Skip heartbeats transparently
+            if header.frame_type() == Some(FrameType::Heartbeat) {
+                continue;
+            }
+
+            if header.frame_type() != Some(FrameType::Response) {
+                return Err(std::io::Error::new(
+                    std::io::ErrorKind::InvalidData,
+                    format!("expected Response frame, got {:?}", header.frame_type()),
+                ));
+            }
+
+            let mut payload = vec![0u8; header.length as usize];
+            reader.read_exact(&mut payload)?;
+
+            return Ok((header, payload));
+        }
+    }
+
     /// Send a heartbeat frame (zero-length payload)
     pub fn send_heartbeat<W: Write>(writer: &mut W) -> std::io::Result<u32> {
         let seq_id = next_seq_id();
@@ -358,6 +385,39 @@ pub mod frame_async {
         Ok(seq_id)
     }
 
+    /// Send a request frame with a caller-allocated seq_id.
+    ///
+    /// Used by pipelined clients that must register the seq_id in their
+    /// pending-response table BEFORE the frame hits the wire (otherwise the
+    /// response could race the registration).
+    pub async fn send_request_with_seq<W: AsyncWriteExt + Unpin>(
+        writer: &mut W,
+        request: &VeloRequest,
+        seq_id: u32,
+    ) -> std::io::Result<()> {
+        let payload = rkyv::to_bytes::<rkyv::rancor::Error>(request)
+            .map_err(|e| std::io::Error::new(std::io::ErrorKind::InvalidData, e))?;
+
+        if payload.len() > IpcHeader::MAX_LENGTH {
+            return Err(std::io::Error::new(
+                std::io::ErrorKind::InvalidData,
+                format!(
+                    "payload too large: {} > {}",
+                    payload.len(),
+                    IpcHeader::MAX_LENGTH
+                ),
+            ));
+        }
+
+        let header = IpcHeader::new_request(payload.len() as u32, seq_id);
+
+        writer.write_all(&header.to_bytes()).await?;
+        writer.write_all(&payload).await?;
+        writer.flush().await?;
+
+        Ok(())
+    }
+
     /// Send a response frame
     pub async fn send_response<W: AsyncWriteExt + Unpin>(
         writer: &mut W,
@@ -552,6 +612,17 @@ pub mod frame_async {
 }
 
 #[derive(Debug, Serialize, Deserialize, Archive, rkyv::Serialize, rkyv::Deserialize)]
+// Recursive via Batch(Vec<VeloRequest>): rkyv needs explicit bounds (derive
+// would otherwise recurse forever computing them).
+#[rkyv(serialize_bounds(
+    __S: rkyv::ser::Writer + rkyv::ser::Allocator,
+    __S::Error: rkyv::rancor::Source,
+))]
+#[rkyv(deserialize_bounds(__D::Error: rkyv::rancor::Source))]
+#[rkyv(bytecheck(bounds(
+    __C: rkyv::validation::ArchiveContext,
+    __C::Error: rkyv::rancor::Source,
+)))]
 pub enum VeloRequest {
     Handshake {
         client_version: String,
@@ -650,6 +721,16 @@ pub enum VeloRequest {
         /// Force full file read+hash, bypassing mtime+size cache skip (P0)
         force_hash: bool,
     },
+    /// Multiple requests in one frame (amortizes header + wakeup cost).
+    /// Server answers with `VeloResponse::Batch` in the same order.
+    /// Linkers and tar-like tools issue hundreds of lookups in tight loops;
+    /// batching turns N round trips into one.
+    Batch(#[rkyv(omit_bounds)] Vec<VeloRequest>),
+    /// Negotiate a per-client shared-memory ring for stat-shaped lookups
+    /// (see `shm_ring`). The server creates the ring file and answers
+    /// with `RingSetupAck`; the client maps it and stops paying socket
+    /// round trips for ManifestGet.
+    RingSetup,
 }
 
 #[derive(Debug, Clone, Serialize, Deserialize, Archive, rkyv::Serialize, rkyv::Deserialize)]
@@ -834,6 +915,16 @@ impl std::fmt::Display for VeloError {
 impl std::error::Error for VeloError {}
 
 #[derive(Debug, Serialize, Deserialize, Archive, rkyv::Serialize, rkyv::Deserialize)]
+// Recursive via Batch(Vec<VeloResponse>): see VeloRequest bounds note.
+#[rkyv(serialize_bounds(
+    __S: rkyv::ser::Writer + rkyv::ser::Allocator,
+    __S::Error: rkyv::rancor::Source,
+))]
+#[rkyv(deserialize_bounds(__D::Error: rkyv::rancor::Source))]
+#[rkyv(bytecheck(bounds(
+    __C: rkyv::validation::ArchiveContext,
+    __C::Error: rkyv::rancor::Source,
+)))]
 pub enum VeloResponse {
     HandshakeAck {
         server_version: String,
@@ -891,6 +982,15 @@ pub enum VeloResponse {
         /// Manifest path
         manifest_path: String,
     },
+    /// Responses for a `VeloRequest::Batch`, in request order
+    Batch(#[rkyv(omit_bounds)] Vec<VeloResponse>),
+    /// Shared-memory ring created for this client (see `shm_ring`)
+    RingSetupAck {
+        /// Path of the ring file to map
+        shm_path: String,
+        /// Slot count the server initialized the ring with
+        slots: u32,
+    },
     /// Structured error response (Phase 3: replaces Error(String))
     Error(VeloError),
 }
@@ -900,6 +1000,27 @@ pub fn is_version_compatible(client_version: u32) -> bool {
     (MIN_PROTOCOL_VERSION..=PROTOCOL_VERSION).contains(&client_version)
 }
 
+// ============================================================================
+// Zero-Copy Payload Access
+// ============================================================================
+//
+// The wire format is already rkyv binary, but `from_bytes` still materializes
+// the full owned enum — every ManifestAck reply heap-allocates before the
+// caller looks at five scalar fields. These helpers validate the payload in
+// place and hand back the archived view, so hot paths (the inception layer's
+// stat storm in particular) can read fields directly out of the receive
+// buffer and never deserialize.
+
+/// Validate and access a request payload in place, without deserializing.
+pub fn access_request(payload: &[u8]) -> Result<&ArchivedVeloRequest, rkyv::rancor::Error> {
+    rkyv::access::<ArchivedVeloRequest, rkyv::rancor::Error>(payload)
+}
+
+/// Validate and access a response payload in place, without deserializing.
+pub fn access_response(payload: &[u8]) -> Result<&ArchivedVeloResponse, rkyv::rancor::Error> {
+    rkyv::access::<ArchivedVeloResponse, rkyv::rancor::Error>(payload)
+}
+
 /// Default socket path (internal fallback for DaemonClient)
 /// Prefer using vrift_config::config().socket_path() when available
 #[cfg(target_os = "linux")]
@@ -1399,6 +1520,117 @@ pub mod client {
                 _ => anyhow::bail!("Unexpected response"),
             }
         }
+
+        /// Send multiple requests in a single `Batch` frame.
+        /// Returns the per-request responses in request order.
+        pub async fn send_batch(
+            &mut self,
+            requests: Vec<VeloRequest>,
+        ) -> anyhow::Result<Vec<VeloResponse>> {
+            let count = requests.len();
+            match self.send(VeloRequest::Batch(requests)).await? {
+                VeloResponse::Batch(responses) => {
+                    if responses.len() != count {
+                        anyhow::bail!(
+                            "Batch response count mismatch: sent {}, got {}",
+                            count,
+                            responses.len()
+                        );
+                    }
+                    Ok(responses)
+                }
+                VeloResponse::Error(e) => anyhow::bail!("Batch failed: {}", e),
+                _ => anyhow::bail!("Unexpected response"),
+            }
+        }
+    }
+
+    /// Pipelined client: multiple requests in flight on ONE connection,
+    /// with responses matched out-of-order by seq_id.
+    ///
+    /// `DaemonClient` is strictly one-frame-in, one-frame-out, which makes the
+    /// daemon a serialization point once many tasks share a connection. This
+    /// client splits the stream: any task may submit a request at any time
+    /// (writes are serialized under a short mutex), and a single reader task
+    /// dispatches responses to waiters via their seq_id.
+    pub struct PipelinedClient {
+        writer: tokio::sync::Mutex<tokio::net::unix::OwnedWriteHalf>,
+        pending: std::sync::Arc<
+            std::sync::Mutex<
+                std::collections::HashMap<u32, tokio::sync::oneshot::Sender<VeloResponse>>,
+            >,
+        >,
+        reader_task: tokio::task::JoinHandle<()>,
+    }
+
+    impl PipelinedClient {
+        /// Connect to a socket and spawn the response dispatcher task
+        pub async fn connect_to(socket_path: &str) -> anyhow::Result<Self> {
+            let stream = UnixStream::connect(Path::new(socket_path)).await?;
+            let (mut read_half, write_half) = stream.into_split();
+
+            let pending: std::sync::Arc<
+                std::sync::Mutex<
+                    std::collections::HashMap<u32, tokio::sync::oneshot::Sender<VeloResponse>>,
+                >,
+            > = std::sync::Arc::new(std::sync::Mutex::new(std::collections::HashMap::new()));
+
+            let pending_reader = pending.clone();
+            let reader_task = tokio::spawn(async move {
+                loop {
+                    match crate::frame_async::read_response(&mut read_half).await {
+                        Ok((header, response)) => {
+                            let waiter = pending_reader.lock().unwrap().remove(&header.seq_id);
+                            if let Some(tx) = waiter {
+                                // Receiver may have been dropped (caller timed out) — fine
+                                let _ = tx.send(response);
+                            }
+                        }
+                        Err(_) => {
+                            // Connection closed: wake all waiters with an error
+                            pending_reader.lock().unwrap().clear();
+                            return;
+                        }
+                    }
+                }
+            });
+
+            Ok(Self {
+                writer: tokio::sync::Mutex::new(write_half),
+                pending,
+                reader_task,
+            })
+        }
+
+        /// Send a request; the future resolves when its response arrives,
+        /// regardless of how many other requests are in flight.
+        pub async fn send(&self, request: VeloRequest) -> anyhow::Result<VeloResponse> {
+            let seq_id = next_seq_id();
+            let (tx, rx) = tokio::sync::oneshot::channel();
+
+            // Register BEFORE writing so the reader can never see an
+            // unregistered seq_id for our request.
+            self.pending.lock().unwrap().insert(seq_id, tx);
+
+            {
+                let mut writer = self.writer.lock().await;
+                if let Err(e) =
+                    crate::frame_async::send_request_with_seq(&mut *writer, &request, seq_id).await
+                {
+                    self.pending.lock().unwrap().remove(&seq_id);
+                    return Err(e.into());
+                }
+            }
+
+            rx.await
+                .map_err(|_| anyhow::anyhow!("connection closed while awaiting response"))
+        }
+    }
+
+    impl Drop for PipelinedClient {
+        fn drop(&mut self) {
+            self.reader_task.abort();
+        }
     }
 }
 
@@ -1426,6 +1658,76 @@ mod tests {
         assert!(matches!(decoded, VeloResponse::StatusAck { .. }));
     }
 
+    #[test]
+    fn test_access_response_zero_copy() {
+        let resp = VeloResponse::ManifestAck {
+            entry: Some(VnodeEntry {
+                content_hash: [0xAB; 32],
+                size: 4096,
+                mtime: 1_700_000_000,
+                mode: 0o644,
+                flags: 0,
+                _pad: 0,
+            }),
+        };
+        let bytes = rkyv::to_bytes::<rkyv::rancor::Error>(&resp).unwrap();
+
+        // Read fields straight from the archived bytes, no deserialization
+        let archived = access_response(&bytes).unwrap();
+        match archived {
+            ArchivedVeloResponse::ManifestAck { entry } => {
+                let e = entry.as_ref().expect("entry present");
+                assert_eq!(e.content_hash, [0xAB; 32]);
+                assert_eq!(e.size.to_native(), 4096);
+                assert_eq!(e.mtime.to_native(), 1_700_000_000);
+                assert_eq!(e.mode.to_native(), 0o644);
+            }
+            _ => panic!("Expected ManifestAck"),
+        }
+
+        // Garbage must be rejected, not misread
+        assert!(access_response(&[0u8; 3]).is_err());
+    }
+
+    #[test]
+    fn test_batch_serialization_roundtrip() {
+        let req = VeloRequest::Batch(vec![
+            VeloRequest::Status,
+            VeloRequest::ManifestGet {
+                path: "/src/main.rs".to_string(),
+            },
+        ]);
+        let bytes = rkyv::to_bytes::<rkyv::rancor::Error>(&req).unwrap();
+        let decoded: VeloRequest =
+            rkyv::from_bytes::<VeloRequest, rkyv::rancor::Error>(&bytes).unwrap();
+        match decoded {
+            VeloRequest::Batch(subs) => {
+                assert_eq!(subs.len(), 2);
+                assert!(matches!(subs[0], VeloRequest::Status));
+                assert!(matches!(subs[1], VeloRequest::ManifestGet { .. }));
+            }
+            other => panic!("Expected Batch, got {:?}", other),
+        }
+
+        let resp = VeloResponse::Batch(vec![
+            VeloResponse::StatusAck {
+                status: "OK".to_string(),
+            },
+            VeloResponse::Error(VeloError::internal("boom")),
+        ]);
+        let bytes = rkyv::to_bytes::<rkyv::rancor::Error>(&resp).unwrap();
+        let decoded: VeloResponse =
+            rkyv::from_bytes::<VeloResponse, rkyv::rancor::Error>(&bytes).unwrap();
+        match decoded {
+            VeloResponse::Batch(subs) => {
+                assert_eq!(subs.len(), 2);
+                assert!(matches!(subs[0], VeloResponse::StatusAck { .. }));
+                assert!(matches!(subs[1], VeloResponse::Error(_)));
+            }
+            other => panic!("Expected Batch, got {:?}", other),
+        }
+    }
+
     #[test]
     fn test_default_socket_path() {
         // Verify default socket path is set
@@ -0,0 +1,465 @@
+//! Shared-memory ring transport for stat-shaped lookups
+//!
+//! Even a perfectly pipelined unix socket costs two syscalls and a wakeup
+//! per round trip, which dominates tiny fixed-size requests like the
+//! inception layer's stat/open miss path. This module defines a per-client
+//! shared-memory ring negotiated over the existing socket
+//! (`VeloRequest::RingSetup` → `VeloResponse::RingSetupAck`): the client
+//! writes a request into a free slot, the daemon answers in place, and
+//! futex wakeups fire only on empty↔non-empty transitions. In the steady
+//! state a lookup is a few atomic operations and no syscalls at all.
+//!
+//! Both sides operate on the same `#[repr(C)]` layout through raw
+//! pointers: the daemon maps the ring file with memmap2, the inception
+//! layer attaches with raw open+mmap (BUG-007b: no libc wrappers) and
+//! hands the pointer to [`ShmRing::from_raw`]. All cross-process
+//! synchronization goes through the per-slot `state` word and the header
+//! `doorbell`, with acquire/release ordering carrying the payload bytes.
+
+use std::sync::atomic::{AtomicU32, Ordering};
+
+/// Magic number identifying a ring region: "VRRG"
+pub const RING_MAGIC: u32 = u32::from_le_bytes(*b"VRRG");
+
+/// Ring layout version — bump on any layout change
+pub const RING_VERSION: u32 = 1;
+
+/// Default slot count (one in-flight request per slot; shim threads
+/// rarely have more than a handful of concurrent lookups)
+pub const RING_DEFAULT_SLOTS: u32 = 64;
+
+/// Maximum path length carried in a slot; longer paths fall back to the
+/// socket transport. Sized so one slot is exactly 512 bytes.
+pub const RING_PATH_MAX: usize = 440;
+
+/// Spins on the slot state before falling back to a futex wait
+const RESPONSE_SPIN: usize = 4096;
+
+/// Per-wait timeout once the spin budget is exhausted
+const RESPONSE_WAIT_MS: u32 = 20;
+
+/// Number of timed waits before declaring the server dead. Total wait is
+/// `RESPONSE_WAIT_BUDGET * RESPONSE_WAIT_MS` (~100ms): long enough that a
+/// daemon merely busy with a compaction still answers, short enough that
+/// an intercepted stat() doesn't visibly hang when the daemon is gone.
+const RESPONSE_WAIT_BUDGET: u32 = 5;
+
+// Slot states (also the futex word for response wakeups)
+pub const SLOT_FREE: u32 = 0;
+/// Client is writing the request payload
+pub const SLOT_CLAIMED: u32 = 1;
+/// Request payload complete, ready for the daemon
+pub const SLOT_REQUEST: u32 = 2;
+/// Response payload complete, ready for the client
+pub const SLOT_RESPONSE: u32 = 3;
+
+// Request opcodes
+pub const RING_OP_MANIFEST_GET: u32 = 1;
+
+// Response status
+pub const RING_STATUS_FOUND: u32 = 0;
+pub const RING_STATUS_NOT_FOUND: u32 = 1;
+pub const RING_STATUS_ERROR: u32 = 2;
+/// Synthesized client-side when the daemon never answers within the wait
+/// budget (never written by the server). Tells the caller the transport
+/// itself is dead — as opposed to a benign `None` refusal — so it can
+/// abandon the ring instead of retrying it on every lookup.
+pub const RING_STATUS_TIMEOUT: u32 = 3;
+
+/// Fixed-size vnode payload answered in place (subset of `VnodeEntry`
+/// that the stat path consumes)
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct RingVnode {
+    pub content_hash: [u8; 32],
+    pub size: u64,
+    pub mtime: u64,
+    pub mode: u32,
+    pub flags: u16,
+    pub _pad: u16,
+}
+
+/// Ring header at offset 0 of the shared region
+#[repr(C)]
+pub struct RingHeader {
+    pub magic: u32,
+    pub version: u32,
+    pub slot_count: u32,
+    /// Size of one slot in bytes (layout cross-check for attachers)
+    pub slot_size: u32,
+    /// Number of submitted-but-unanswered requests; futex word for the
+    /// daemon's idle wait. Woken only on the 0 → 1 transition.
+    pub doorbell: AtomicU32,
+    _pad: [u8; 44],
+}
+
+/// One request/response slot, cache-line aligned to keep concurrent
+/// clients off each other's lines
+#[repr(C, align(64))]
+pub struct RingSlot {
+    /// Slot lifecycle state; futex word for the client's response wait
+    pub state: AtomicU32,
+    pub op: u32,
+    pub path_len: u32,
+    pub status: u32,
+    pub path: [u8; RING_PATH_MAX],
+    pub entry: RingVnode,
+}
+
+const HEADER_SIZE: usize = std::mem::size_of::<RingHeader>();
+const SLOT_SIZE: usize = std::mem::size_of::<RingSlot>();
+
+/// A validated view over a mapped ring region (either side)
+///
+/// Holds only the raw pointer — the mapping's lifetime is managed by the
+/// caller (memmap2 on the daemon side, a raw mmap that lives for the
+/// process on the shim side).
+pub struct ShmRing {
+    header: *const RingHeader,
+    slots: *mut RingSlot,
+    slot_count: u32,
+}
+
+// All shared mutation goes through atomics; the payload bytes are only
+// written by whichever side owns the slot per its state word.
+unsafe impl Send for ShmRing {}
+unsafe impl Sync for ShmRing {}
+
+impl ShmRing {
+    /// Bytes required for a ring with `slots` slots
+    pub fn required_size(slots: u32) -> usize {
+        HEADER_SIZE + slots as usize * SLOT_SIZE
+    }
+
+    /// Initialize a zeroed region as a ring (server side)
+    ///
+    /// # Safety
+    /// `ptr` must point to at least `required_size(slots)` writable bytes,
+    /// 64-byte aligned, zero-initialized, not yet shared with any client.
+    pub unsafe fn init_in_place(ptr: *mut u8, slots: u32) -> Self {
+        let header = ptr as *mut RingHeader;
+        (*header).magic = RING_MAGIC;
+        (*header).version = RING_VERSION;
+        (*header).slot_count = slots;
+        (*header).slot_size = SLOT_SIZE as u32;
+        Self {
+            header,
+            slots: ptr.add(HEADER_SIZE) as *mut RingSlot,
+            slot_count: slots,
+        }
+    }
+
+    /// Attach to an existing ring region, validating the layout
+    ///
+    /// # Safety
+    /// `ptr` must point to `len` bytes of a live shared mapping that
+    /// outlives the returned ring.
+    pub unsafe fn from_raw(ptr: *const u8, len: usize) -> Option<Self> {
+        if ptr.is_null() || len < HEADER_SIZE {
+            return None;
+        }
+        let header = ptr as *const RingHeader;
+        if (*header).magic != RING_MAGIC
+            || (*header).version != RING_VERSION
+            || (*header).slot_size != SLOT_SIZE as u32
+        {
+            return None;
+        }
+        let slot_count = (*header).slot_count;
+        if len < Self::required_size(slot_count) {
+            return None;
+        }
+        Some(Self {
+            header,
+            slots: ptr.add(HEADER_SIZE) as *mut RingSlot,
+            slot_count,
+        })
+    }
+
+    fn header(&self) -> &RingHeader {
+        unsafe { &*self.header }
+    }
+
+    /// Raw slot pointer — payload writes must go through this (not a
+    /// shared reference) so the side that owns the slot per its state
+    /// word can mutate it
+    fn slot_ptr(&self, idx: u32) -> *mut RingSlot {
+        debug_assert!(idx < self.slot_count);
+        unsafe { self.slots.add(idx as usize) }
+    }
+
+    fn slot_state(&self, idx: u32) -> &AtomicU32 {
+        unsafe { &(*self.slot_ptr(idx)).state }
+    }
+
+    // ------------------------------------------------------------------
+    // Client side
+    // ------------------------------------------------------------------
+
+    /// Submit a ManifestGet and wait for the in-place answer.
+    ///
+    /// Returns `None` if the transport can't serve the request (path too
+    /// long, no free slot) — the caller falls back to the socket for this
+    /// call only. Spins briefly for the common sub-µs response, then
+    /// futex-waits with a bounded budget; if the budget expires the status
+    /// is [`RING_STATUS_TIMEOUT`] and the caller should stop using the
+    /// ring entirely (the daemon is dead or this mapping is orphaned).
+    pub fn manifest_get(&self, path: &[u8]) -> Option<(u32, RingVnode)> {
+        if path.len() > RING_PATH_MAX {
+            return None;
+        }
+        let idx = self.claim_slot()?;
+        let slot = self.slot_ptr(idx);
+        let state = self.slot_state(idx);
+
+        // We own the slot (CLAIMED): fill the request payload
+        unsafe {
+            std::ptr::copy_nonoverlapping(path.as_ptr(), (*slot).path.as_mut_ptr(), path.len());
+            (*slot).op = RING_OP_MANIFEST_GET;
+            (*slot).path_len = path.len() as u32;
+        }
+
+        // Publish, and ring the doorbell only on the empty → non-empty
+        // transition
+        state.store(SLOT_REQUEST, Ordering::Release);
+        if self.header().doorbell.fetch_add(1, Ordering::AcqRel) == 0 {
+            futex_wake(&self.header().doorbell);
+        }
+
+        // Wait for the daemon's in-place answer — bounded. An unbounded
+        // futex wait here parks the caller forever when the daemon dies or
+        // restarts (its poller thread dies with it and nothing ever stores
+        // SLOT_RESPONSE), so past the spin budget each wait is timed and
+        // capped. On expiry the slot is abandoned as-is: retracting it with
+        // a REQUEST → FREE CAS would race the daemon's in-place serve
+        // (drain_requests checks the state once, then writes the payload
+        // unconditionally), and the caller drops the transport on timeout
+        // anyway, so leaking one slot of a dead ring is the safe trade.
+        let mut spins = 0;
+        let mut waits = 0;
+        while state.load(Ordering::Acquire) != SLOT_RESPONSE {
+            spins += 1;
+            if spins < RESPONSE_SPIN {
+                std::hint::spin_loop();
+            } else if waits < RESPONSE_WAIT_BUDGET {
+                waits += 1;
+                futex_wait_timeout(state, SLOT_REQUEST, RESPONSE_WAIT_MS);
+            } else {
+                return Some((RING_STATUS_TIMEOUT, RingVnode::default()));
+            }
+        }
+
+        let (status, entry) = unsafe { ((*slot).status, (*slot).entry) };
+        state.store(SLOT_FREE, Ordering::Release);
+        Some((status, entry))
+    }
+
+    /// Find and claim a free slot
+    fn claim_slot(&self) -> Option<u32> {
+        for idx in 0..self.slot_count {
+            if self
+                .slot_state(idx)
+                .compare_exchange(SLOT_FREE, SLOT_CLAIMED, Ordering::Acquire, Ordering::Relaxed)
+                .is_ok()
+            {
+                return Some(idx);
+            }
+        }
+        None
+    }
+
+    // ------------------------------------------------------------------
+    // Server side
+    // ------------------------------------------------------------------
+
+    /// Block until the doorbell is non-zero (or the timeout elapses)
+    pub fn wait_for_requests(&self, timeout_ms: u32) {
+        if self.header().doorbell.load(Ordering::Acquire) == 0 {
+            futex_wait_timeout(&self.header().doorbell, 0, timeout_ms);
+        }
+    }
+
+    /// Answer every pending request in place via `serve`, batching one
+    /// sweep over the slots. Returns the number served.
+    pub fn drain_requests<F>(&self, mut serve: F) -> u32
+    where
+        F: FnMut(u32, &[u8]) -> (u32, RingVnode),
+    {
+        let mut served = 0;
+        for idx in 0..self.slot_count {
+            let state = self.slot_state(idx);
+            if state.load(Ordering::Acquire) != SLOT_REQUEST {
+                continue;
+            }
+            let slot = self.slot_ptr(idx);
+
+            let (status, entry) = unsafe {
+                let path_len = ((*slot).path_len as usize).min(RING_PATH_MAX);
+                let path = std::slice::from_raw_parts((*slot).path.as_ptr(), path_len);
+                serve((*slot).op, path)
+            };
+
+            unsafe {
+                (*slot).status = status;
+                (*slot).entry = entry;
+            }
+            state.store(SLOT_RESPONSE, Ordering::Release);
+            futex_wake(state);
+            served += 1;
+        }
+        if served > 0 {
+            self.header().doorbell.fetch_sub(served, Ordering::AcqRel);
+        }
+        served
+    }
+}
+
+// ============================================================================
+// Futex wrappers
+// ============================================================================
+//
+// Linux gets real futex wait/wake; elsewhere the waiters poll with a short
+// sleep, which keeps the transport correct (the state words are the source
+// of truth) at the cost of wakeup latency.
+
+#[cfg(target_os = "linux")]
+fn futex_wait_timeout(word: &AtomicU32, expected: u32, timeout_ms: u32) {
+    let ts = libc::timespec {
+        tv_sec: (timeout_ms / 1000) as libc::time_t,
+        tv_nsec: ((timeout_ms % 1000) * 1_000_000) as libc::c_long,
+    };
+    unsafe {
+        libc::syscall(libc::SYS_futex, word.as_ptr(), libc::FUTEX_WAIT, expected, &ts);
+    }
+}
+
+#[cfg(target_os = "linux")]
+fn futex_wake(word: &AtomicU32) {
+    unsafe {
+        libc::syscall(libc::SYS_futex, word.as_ptr(), libc::FUTEX_WAKE, i32::MAX);
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn futex_wait_timeout(word: &AtomicU32, expected: u32, timeout_ms: u32) {
+    let deadline =
+        std::time::Instant::now() + std::time::Duration::from_millis(timeout_ms as u64);
+    while word.load(Ordering::Acquire) == expected && std::time::Instant::now() < deadline {
+        std::thread::sleep(std::time::Duration::from_micros(50));
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn futex_wake(_word: &AtomicU32) {}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::alloc::{alloc_zeroed, dealloc, Layout};
+    use std::sync::atomic::AtomicBool;
+    use std::sync::Arc;
+
+    struct TestRegion {
+        ptr: *mut u8,
+        layout: Layout,
+    }
+
+    impl TestRegion {
+        fn new(slots: u32) -> Self {
+            let layout = Layout::from_size_align(ShmRing::required_size(slots), 64).unwrap();
+            let ptr = unsafe { alloc_zeroed(layout) };
+            Self { ptr, layout }
+        }
+    }
+
+    impl Drop for TestRegion {
+        fn drop(&mut self) {
+            unsafe { dealloc(self.ptr, self.layout) };
+        }
+    }
+
+    #[test]
+    fn test_ring_layout_stable() {
+        // Attachers cross-check these against the header; changing the
+        // layout requires a RING_VERSION bump
+        assert_eq!(std::mem::size_of::<RingHeader>(), 64);
+        assert_eq!(std::mem::size_of::<RingSlot>(), 512);
+    }
+
+    #[test]
+    fn test_ring_attach_validates() {
+        let region = TestRegion::new(4);
+        unsafe {
+            // Uninitialized region must be rejected
+            assert!(ShmRing::from_raw(region.ptr, ShmRing::required_size(4)).is_none());
+
+            ShmRing::init_in_place(region.ptr, 4);
+            assert!(ShmRing::from_raw(region.ptr, ShmRing::required_size(4)).is_some());
+            // Truncated mapping must be rejected
+            assert!(ShmRing::from_raw(region.ptr, HEADER_SIZE).is_none());
+        }
+    }
+
+    #[test]
+    fn test_ring_roundtrip_across_threads() {
+        let region = TestRegion::new(8);
+        let server = unsafe { ShmRing::init_in_place(region.ptr, 8) };
+        let client = unsafe { ShmRing::from_raw(region.ptr, ShmRing::required_size(8)) }.unwrap();
+
+        let stop = Arc::new(AtomicBool::new(false));
+        let server_stop = Arc::clone(&stop);
+        let server_thread = std::thread::spawn(move || {
+            while !server_stop.load(Ordering::Relaxed) {
+                server.wait_for_requests(10);
+                server.drain_requests(|op, path| {
+                    assert_eq!(op, RING_OP_MANIFEST_GET);
+                    // Echo handler: size = path length, found iff nonempty
+                    if path.is_empty() {
+                        (RING_STATUS_NOT_FOUND, RingVnode::default())
+                    } else {
+                        let entry = RingVnode {
+                            content_hash: [path[0]; 32],
+                            size: path.len() as u64,
+                            mtime: 7,
+                            mode: 0o644,
+                            flags: 0,
+                            _pad: 0,
+                        };
+                        (RING_STATUS_FOUND, entry)
+                    }
+                });
+            }
+        });
+
+        for i in 0..200u32 {
+            let path = format!("/src/file_{i}.rs");
+            let (status, entry) = client.manifest_get(path.as_bytes()).unwrap();
+            assert_eq!(status, RING_STATUS_FOUND);
+            assert_eq!(entry.size, path.len() as u64);
+            assert_eq!(entry.content_hash[0], b'/');
+        }
+
+        // Oversized path falls back to the socket transport
+        let long = vec![b'a'; RING_PATH_MAX + 1];
+        assert!(client.manifest_get(&long).is_none());
+
+        stop.store(true, Ordering::Relaxed);
+        server_thread.join().unwrap();
+    }
+
+    #[test]
+    fn test_ring_unanswered_request_times_out() {
+        // No server polling the ring — the exact shape of a daemon restart
+        // from the client's perspective. The request must come back as a
+        // timeout within the wait budget instead of parking forever.
+        let region = TestRegion::new(4);
+        unsafe { ShmRing::init_in_place(region.ptr, 4) };
+        let client = unsafe { ShmRing::from_raw(region.ptr, ShmRing::required_size(4)) }.unwrap();
+
+        let start = std::time::Instant::now();
+        let (status, _) = client.manifest_get(b"/src/orphan.rs").unwrap();
+        assert_eq!(status, RING_STATUS_TIMEOUT);
+        // Budget is ~100ms; leave generous slack for slow CI
+        assert!(start.elapsed() < std::time::Duration::from_secs(5));
+    }
+}
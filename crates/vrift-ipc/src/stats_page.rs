@@ -0,0 +1,227 @@
+//! Always-on hot-path performance counters (stats page)
+//!
+//! A small shared-memory page of striped counters written by the inception
+//! layer on every interposed syscall and sampled live by `vrift stats`.
+//! The layout is shared between the shim (writer) and the CLI (reader), so
+//! it lives here next to `vdir_types` and `shm_ring`.
+//!
+//! Counting is a single relaxed `fetch_add` on a stripe chosen from the
+//! calling thread's identity; stripes are cache-line aligned so two threads
+//! never contend on the same line. The reader sums stripes at sample time.
+
+use std::sync::atomic::{AtomicU64, Ordering};
+
+/// "VRPC" — stats page magic
+pub const STATS_MAGIC: u32 = u32::from_le_bytes(*b"VRPC");
+pub const STATS_VERSION: u32 = 1;
+
+/// Number of counter stripes. Threads hash onto a stripe; 16 is enough to
+/// keep false sharing negligible for typical build parallelism.
+pub const STATS_STRIPES: usize = 16;
+
+// ==================== Counter IDs ====================
+// Order is the wire format: the CLI indexes `COUNTER_NAMES` by ID, so new
+// counters are appended and STATS_VERSION is bumped on any reorder.
+
+/// stat served from the VDir / dirty temp file (no kernel stat)
+pub const CTR_STAT_HIT: usize = 0;
+/// stat fell through to IPC or the OS
+pub const CTR_STAT_MISS: usize = 1;
+/// open redirected to a CAS blob
+pub const CTR_OPEN_HIT: usize = 2;
+/// open passed through to the OS
+pub const CTR_OPEN_MISS: usize = 3;
+/// resolve_path classified the path as VFS-owned
+pub const CTR_RESOLVE_VFS: usize = 4;
+/// resolve_path classified the path as outside the VFS
+pub const CTR_RESOLVE_PASSTHROUGH: usize = 5;
+/// Completed socket round trips to the daemon / vDird
+pub const CTR_IPC_ROUNDTRIP: usize = 6;
+/// Failed daemon connections (circuit breaker feed)
+pub const CTR_IPC_FAIL: usize = 7;
+/// ManifestGet served through the shared-memory ring
+pub const CTR_RING_LOOKUP: usize = 8;
+/// stat bypassed the mmap cache because the file had pending writes
+pub const CTR_DIRTY_BYPASS: usize = 9;
+/// Copy-on-write materializations
+pub const CTR_COW: usize = 10;
+/// Successful reingests after write-close
+pub const CTR_REINGEST: usize = 11;
+/// Tasks pushed to the background worker rings
+pub const CTR_WORKER_PUSH: usize = 12;
+/// Tasks drained by the background workers (push − pop = queue depth)
+pub const CTR_WORKER_POP: usize = 13;
+/// Read-only mmap served straight from the CAS blob (shared page cache)
+pub const CTR_MMAP_BLOB: usize = 14;
+
+pub const COUNTER_COUNT: usize = 15;
+
+pub static COUNTER_NAMES: [&str; COUNTER_COUNT] = [
+    "stat_hit",
+    "stat_miss",
+    "open_hit",
+    "open_miss",
+    "resolve_vfs",
+    "resolve_passthrough",
+    "ipc_roundtrip",
+    "ipc_fail",
+    "ring_lookup",
+    "dirty_bypass",
+    "cow",
+    "reingest",
+    "worker_push",
+    "worker_pop",
+    "mmap_blob",
+];
+
+/// Counters per stripe, rounded up to whole cache lines so adjacent stripes
+/// never share one.
+pub const STRIPE_WIDTH: usize = (COUNTER_COUNT + 7) & !7;
+
+/// One thread stripe: a cache-line-aligned row of counters. Only threads
+/// hashing to this stripe write it; same-row sharing is intentional.
+#[repr(C, align(64))]
+pub struct StatsStripe {
+    pub counters: [AtomicU64; STRIPE_WIDTH],
+}
+
+impl StatsStripe {
+    pub const fn new() -> Self {
+        #[allow(clippy::declare_interior_mutable_const)]
+        const ZERO: AtomicU64 = AtomicU64::new(0);
+        Self {
+            counters: [ZERO; STRIPE_WIDTH],
+        }
+    }
+}
+
+impl Default for StatsStripe {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// The shared stats page: one header line plus `STATS_STRIPES` stripes.
+/// Writers only ever `fetch_add`; the header is written once at publish.
+#[repr(C, align(64))]
+pub struct StatsPage {
+    pub magic: AtomicU64, // low 32 bits magic, high 32 bits version
+    pub pid: AtomicU64,
+    pub start_unix: AtomicU64,
+    _pad: [u64; 5],
+    pub stripes: [StatsStripe; STATS_STRIPES],
+}
+
+impl StatsPage {
+    pub const SIZE: usize = std::mem::size_of::<StatsPage>();
+
+    /// Const constructor so the shim can keep a process-local fallback page
+    /// in a `static` (counts are never dropped, only unpublished).
+    pub const fn new() -> Self {
+        #[allow(clippy::declare_interior_mutable_const)]
+        const STRIPE: StatsStripe = StatsStripe::new();
+        Self {
+            magic: AtomicU64::new(0),
+            pid: AtomicU64::new(0),
+            start_unix: AtomicU64::new(0),
+            _pad: [0; 5],
+            stripes: [STRIPE; STATS_STRIPES],
+        }
+    }
+
+    /// Stamp the header after the backing file is mapped. Readers treat a
+    /// page without a valid magic as not-yet-published.
+    pub fn publish_header(&self, pid: u32, start_unix: u64) {
+        self.pid.store(pid as u64, Ordering::Relaxed);
+        self.start_unix.store(start_unix, Ordering::Relaxed);
+        self.magic.store(
+            (STATS_MAGIC as u64) | ((STATS_VERSION as u64) << 32),
+            Ordering::Release,
+        );
+    }
+
+    /// Attach to an existing mapping, validating size and header.
+    ///
+    /// # Safety
+    /// `ptr` must point to at least `len` bytes of live, 64-byte-aligned
+    /// shared memory that outlives the returned reference.
+    pub unsafe fn from_raw(ptr: *const u8, len: usize) -> Option<&'static StatsPage> {
+        if ptr.is_null() || len < Self::SIZE || ptr as usize % 64 != 0 {
+            return None;
+        }
+        let page = &*(ptr as *const StatsPage);
+        let magic = page.magic.load(Ordering::Acquire);
+        if magic as u32 != STATS_MAGIC || (magic >> 32) as u32 != STATS_VERSION {
+            return None;
+        }
+        Some(page)
+    }
+
+    /// The hot-path increment: one relaxed add, no branches beyond the
+    /// bounds that the constants already guarantee.
+    #[inline(always)]
+    pub fn bump(&self, stripe: usize, counter: usize) {
+        self.stripes[stripe % STATS_STRIPES].counters[counter].fetch_add(1, Ordering::Relaxed);
+    }
+
+    /// Sum a counter across stripes (reader side; racy but monotone).
+    pub fn total(&self, counter: usize) -> u64 {
+        self.stripes
+            .iter()
+            .map(|s| s.counters[counter].load(Ordering::Relaxed))
+            .sum()
+    }
+
+    /// Snapshot every counter (for rate computation between two samples).
+    pub fn snapshot(&self) -> [u64; COUNTER_COUNT] {
+        let mut out = [0u64; COUNTER_COUNT];
+        for (i, slot) in out.iter_mut().enumerate() {
+            *slot = self.total(i);
+        }
+        out
+    }
+}
+
+impl Default for StatsPage {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_stats_page_layout() {
+        // Stripes must be whole cache lines and the page a fixed ABI
+        assert_eq!(std::mem::size_of::<StatsStripe>() % 64, 0);
+        assert_eq!(std::mem::align_of::<StatsPage>(), 64);
+        assert_eq!(
+            StatsPage::SIZE,
+            64 + STATS_STRIPES * std::mem::size_of::<StatsStripe>()
+        );
+        assert_eq!(COUNTER_NAMES.len(), COUNTER_COUNT);
+    }
+
+    #[test]
+    fn test_bump_total_and_attach() {
+        static PAGE: StatsPage = StatsPage::new();
+
+        // Unpublished page must not validate
+        let ptr = &PAGE as *const StatsPage as *const u8;
+        assert!(unsafe { StatsPage::from_raw(ptr, StatsPage::SIZE) }.is_none());
+
+        PAGE.publish_header(42, 1_000);
+        let page = unsafe { StatsPage::from_raw(ptr, StatsPage::SIZE) }.expect("valid page");
+        assert_eq!(page.pid.load(Ordering::Relaxed), 42);
+
+        // Counts from different stripes aggregate
+        page.bump(0, CTR_STAT_HIT);
+        page.bump(7, CTR_STAT_HIT);
+        page.bump(STATS_STRIPES + 3, CTR_STAT_HIT); // wraps
+        assert_eq!(page.total(CTR_STAT_HIT), 3);
+        assert_eq!(page.snapshot()[CTR_STAT_HIT], 3);
+        assert_eq!(page.total(CTR_STAT_MISS), 0);
+    }
+}
@@ -132,3 +132,126 @@ impl VDirEntry {
         (self.flags & FLAG_SYMLINK) != 0
     }
 }
+
+// ---------------------------------------------------------------------------
+// Directory-listing index — sibling mmap file (`<vdir>.diridx`)
+// ---------------------------------------------------------------------------
+//
+// The VDir table stores only path hashes, so readdir used to fall back to
+// IPC for every directory. The dir index is a precomputed, read-only snapshot
+// built by vDird: a hash table keyed by directory path hash, pointing into a
+// contiguous pool of sorted child records. An intercepted readdir walks one
+// contiguous region — no IPC, no per-entry hashing.
+//
+// Freshness: the header records the VDir generation the index was built
+// from. Readers compare it against the live VDir generation and fall back to
+// IPC on mismatch, so a stale index can never serve a wrong listing.
+
+/// Dir index magic number: "VIDX" in little-endian
+pub const DIRIDX_MAGIC: u32 = 0x58444956;
+
+/// Dir index format version. Bump on incompatible changes.
+pub const DIRIDX_VERSION: u32 = 1;
+
+/// Compile-time header size
+pub const DIRIDX_HEADER_SIZE: usize = std::mem::size_of::<DirIndexHeader>();
+
+/// Compile-time slot size
+pub const DIRIDX_SLOT_SIZE: usize = std::mem::size_of::<DirIndexSlot>();
+
+/// Child record d_type values (match dirent d_type)
+pub const DIRIDX_DT_DIR: u8 = 4;
+pub const DIRIDX_DT_REG: u8 = 8;
+pub const DIRIDX_DT_LNK: u8 = 10;
+
+/// Dir index header in shared memory.
+///
+/// Layout (64 bytes total):
+/// ```text
+/// offset  field             size
+/// ------  ---------------   ----
+///  0      magic             4    (0x58444956)
+///  4      version           4
+///  8      generation        8    (seqlock counter, must be AtomicU64-aligned)
+/// 16      vdir_generation   8    (VDir generation this index was built from)
+/// 24      dir_count         4
+/// 28      table_capacity    4
+/// 32      table_offset      4
+/// 36      pool_offset       4
+/// 40      pool_size         4    (bytes used in the children pool)
+/// 44      crc32             4
+/// 48      _pad             16
+/// ```
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct DirIndexHeader {
+    pub magic: u32,
+    pub version: u32,
+    pub generation: u64, // Atomic counter for seqlock synchronization
+    pub vdir_generation: u64,
+    pub dir_count: u32,
+    pub table_capacity: u32,
+    pub table_offset: u32,
+    pub pool_offset: u32,
+    pub pool_size: u32,
+    pub crc32: u32,     // CRC32 checksum of header (fields before crc32)
+    pub _pad: [u8; 16], // Pad to 64 bytes
+}
+
+// Compile-time assertion: DirIndexHeader must be exactly 64 bytes
+const _: () = assert!(std::mem::size_of::<DirIndexHeader>() == 64);
+
+/// Single dir index slot (open addressing, linear probing).
+///
+/// Layout (24 bytes total):
+/// ```text
+/// offset  field             size
+/// ------  ---------------   ----
+///  0      dir_hash           8   (FNV-1a of directory path, 0 = empty slot)
+///  8      children_offset    4   (byte offset from pool_offset)
+/// 12      children_bytes     4
+/// 16      children_count     4
+/// 20      _pad               4
+/// ```
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default)]
+pub struct DirIndexSlot {
+    pub dir_hash: u64,
+    pub children_offset: u32,
+    pub children_bytes: u32,
+    pub children_count: u32,
+    pub _pad: u32,
+}
+
+// Compile-time assertion: DirIndexSlot must be exactly 24 bytes
+const _: () = assert!(std::mem::size_of::<DirIndexSlot>() == 24);
+
+impl DirIndexSlot {
+    /// True if slot is empty (never written)
+    #[inline]
+    pub fn is_empty(&self) -> bool {
+        self.dir_hash == 0
+    }
+}
+
+/// Fixed prefix of each child record in the pool; followed by `name_len`
+/// name bytes, with the whole record padded to 4-byte alignment.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct DirIndexChild {
+    pub name_len: u16,
+    pub d_type: u8, // DIRIDX_DT_DIR | DIRIDX_DT_REG | DIRIDX_DT_LNK
+    pub _pad: u8,
+}
+
+/// Compile-time child prefix size
+pub const DIRIDX_CHILD_HEADER_SIZE: usize = std::mem::size_of::<DirIndexChild>();
+
+// Compile-time assertion: DirIndexChild prefix must be exactly 4 bytes
+const _: () = assert!(std::mem::size_of::<DirIndexChild>() == 4);
+
+/// Total bytes a child record occupies in the pool (prefix + name, 4-aligned)
+#[inline]
+pub fn diridx_child_record_len(name_len: usize) -> usize {
+    (DIRIDX_CHILD_HEADER_SIZE + name_len + 3) & !3
+}
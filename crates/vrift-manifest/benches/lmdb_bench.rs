@@ -0,0 +1,85 @@
+//! LmdbManifest lookup/insert microbenchmarks
+//!
+//! The LMDB manifest backs every cold stat and all mutation traffic, so
+//! single-op latency here bounds the daemon's fallback path. Populated at
+//! a build-sized 10k entries before measuring.
+//!
+//! Machine-readable results land in target/criterion/*/estimates.json;
+//! compare releases with `cargo bench -- --save-baseline <tag>`.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use tempfile::tempdir;
+use vrift_manifest::lmdb::{AssetTier, LmdbManifest};
+use vrift_manifest::VnodeEntry;
+
+const ENTRIES: usize = 10_000;
+
+fn vnode(i: usize) -> VnodeEntry {
+    VnodeEntry {
+        content_hash: [i as u8; 32],
+        size: 4096,
+        mtime: 1_700_000_000,
+        mode: 0o644,
+        flags: 0,
+        _pad: 0,
+    }
+}
+
+fn populated_manifest(dir: &std::path::Path) -> LmdbManifest {
+    let manifest = LmdbManifest::open(dir.join("bench.lmdb")).unwrap();
+    for i in 0..ENTRIES {
+        manifest.insert(
+            &format!("src/module_{i}/file_{i}.rs"),
+            vnode(i),
+            AssetTier::Tier2Mutable,
+        );
+    }
+    manifest
+}
+
+fn bench_lmdb_get_hit(c: &mut Criterion) {
+    let temp = tempdir().unwrap();
+    let manifest = populated_manifest(temp.path());
+
+    let mut i = 0usize;
+    c.bench_function("lmdb_get_hit", |b| {
+        b.iter(|| {
+            i = (i + 1) % ENTRIES;
+            let path = format!("src/module_{i}/file_{i}.rs");
+            black_box(manifest.get(&path).unwrap()).is_some()
+        })
+    });
+}
+
+fn bench_lmdb_get_miss(c: &mut Criterion) {
+    let temp = tempdir().unwrap();
+    let manifest = populated_manifest(temp.path());
+
+    c.bench_function("lmdb_get_miss", |b| {
+        b.iter(|| black_box(manifest.get("src/no/such/path.rs").unwrap()).is_none())
+    });
+}
+
+fn bench_lmdb_insert(c: &mut Criterion) {
+    let temp = tempdir().unwrap();
+    let manifest = populated_manifest(temp.path());
+
+    let mut i = 0usize;
+    c.bench_function("lmdb_insert", |b| {
+        b.iter(|| {
+            // Overwrites cycle through the existing key space, matching a
+            // rebuild touching the same files
+            i = (i + 1) % ENTRIES;
+            let path = format!("src/module_{i}/file_{i}.rs");
+            manifest.insert(black_box(&path), vnode(i), AssetTier::Tier2Mutable);
+        })
+    });
+}
+
+criterion_group!(
+    benches,
+    bench_lmdb_get_hit,
+    bench_lmdb_get_miss,
+    bench_lmdb_insert
+);
+criterion_main!(benches);
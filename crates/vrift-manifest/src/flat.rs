@@ -0,0 +1,496 @@
+//! Flat mmap-able manifest snapshot (RFC-0044)
+//!
+//! [`Manifest::save`] round-trips the whole HashMap through rkyv, so every
+//! consumer pays a full parse-and-allocate at startup — O(entries) time and
+//! ~2x the manifest size in heap. The flat snapshot is an alignment-safe
+//! on-disk layout that loads via a single `mmap` with zero parsing:
+//!
+//! ```text
+//! [FlatHeader: 64 B]
+//! [FlatRecord x entry_count: 96 B each, 8-aligned]   fixed-width records
+//! [u32 x slot_count]                                 open-addressed index
+//! [string table]                                     concatenated paths
+//! ```
+//!
+//! The index is keyed by the first 8 bytes of [`compute_path_hash`] with
+//! linear probing; each slot holds `record_index + 1` (0 = empty). Records
+//! embed a `#[repr(C)]` [`VnodeEntry`] verbatim, so `get`/`get_by_hash`
+//! return references straight into the mapping and startup cost is
+//! O(page faults actually taken), not O(entries).
+
+use std::fs::{self, File};
+use std::io::{BufWriter, Write};
+use std::path::Path;
+
+use memmap2::Mmap;
+
+use crate::{
+    compute_path_hash, Manifest, ManifestError, ManifestStats, PathHash, Result, VnodeEntry,
+};
+
+/// Magic bytes identifying a flat manifest snapshot
+pub const FLAT_MAGIC: [u8; 4] = *b"VRFM";
+
+/// Current flat snapshot format version
+pub const FLAT_VERSION: u32 = 1;
+
+const HEADER_SIZE: usize = 64;
+const RECORD_SIZE: usize = 96;
+const SLOT_SIZE: usize = 4;
+
+/// On-disk header, written at offset 0.
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+struct FlatHeader {
+    magic: [u8; 4],
+    version: u32,
+    /// Number of FlatRecords
+    entry_count: u64,
+    /// Index capacity (power of two, >= 2 * entry_count)
+    slot_count: u64,
+    /// Byte offset of the record array (8-aligned)
+    records_off: u64,
+    /// Byte offset of the index slots
+    index_off: u64,
+    /// Byte offset of the string table
+    strtab_off: u64,
+    /// Length of the string table in bytes
+    strtab_len: u64,
+    _reserved: u64,
+}
+
+/// Fixed-width on-disk record: path hash + vnode + string table slice.
+#[repr(C)]
+#[derive(Debug)]
+struct FlatRecord {
+    path_hash: PathHash,
+    vnode: VnodeEntry,
+    path_off: u32,
+    path_len: u32,
+}
+
+// The zero-parse reader reinterprets mmap bytes as these structs, so their
+// layout must never drift from the documented format.
+const _: () = assert!(std::mem::size_of::<FlatHeader>() == HEADER_SIZE);
+const _: () = assert!(std::mem::size_of::<FlatRecord>() == RECORD_SIZE);
+const _: () = assert!(std::mem::align_of::<FlatRecord>() == 8);
+
+impl Manifest {
+    /// Save the manifest as a flat mmap-able snapshot
+    ///
+    /// Written atomically (temp file + rename) so concurrent readers never
+    /// see a partial snapshot. Load with [`FlatManifest::open`] for
+    /// zero-copy access, or [`Manifest::load`] which hydrates it.
+    pub fn save_flat<P: AsRef<Path>>(&self, path: P) -> Result<()> {
+        let path = path.as_ref();
+
+        // Build records and string table in insertion-independent order.
+        let mut records = Vec::with_capacity(self.entries.len());
+        let mut strtab: Vec<u8> = Vec::new();
+        for (hash, entry) in &self.entries {
+            let (path_off, path_len) = match self.paths.get(hash) {
+                Some(p) => {
+                    let off = strtab.len() as u32;
+                    strtab.extend_from_slice(p.as_bytes());
+                    (off, p.len() as u32)
+                }
+                None => (0, 0),
+            };
+            records.push(FlatRecord {
+                path_hash: *hash,
+                vnode: entry.clone(),
+                path_off,
+                path_len,
+            });
+        }
+
+        // Open-addressed index: slot -> record_index + 1, 0 = empty.
+        // 2x overprovisioning keeps linear probe chains short.
+        let slot_count = (records.len() * 2).next_power_of_two().max(8);
+        let mask = slot_count - 1;
+        let mut index = vec![0u32; slot_count];
+        for (i, rec) in records.iter().enumerate() {
+            let mut slot = probe_start(&rec.path_hash) & mask;
+            while index[slot] != 0 {
+                slot = (slot + 1) & mask;
+            }
+            index[slot] = (i + 1) as u32;
+        }
+
+        let records_off = HEADER_SIZE as u64;
+        let index_off = records_off + (records.len() * RECORD_SIZE) as u64;
+        let strtab_off = index_off + (slot_count * SLOT_SIZE) as u64;
+        let header = FlatHeader {
+            magic: FLAT_MAGIC,
+            version: FLAT_VERSION,
+            entry_count: records.len() as u64,
+            slot_count: slot_count as u64,
+            records_off,
+            index_off,
+            strtab_off,
+            strtab_len: strtab.len() as u64,
+            _reserved: 0,
+        };
+
+        let tmp_path = path.with_extension("flat.tmp");
+        let file = File::create(&tmp_path)?;
+        let mut writer = BufWriter::new(file);
+        // SAFETY: FlatHeader/FlatRecord are #[repr(C)] with no padding
+        // (size asserts above) and contain only plain integer fields.
+        unsafe {
+            writer.write_all(as_bytes(&header))?;
+            for rec in &records {
+                writer.write_all(as_bytes(rec))?;
+            }
+        }
+        for slot in &index {
+            writer.write_all(&slot.to_le_bytes())?;
+        }
+        writer.write_all(&strtab)?;
+        writer.flush()?;
+        drop(writer);
+        fs::rename(&tmp_path, path)?;
+        Ok(())
+    }
+}
+
+/// Probe start position: first 8 bytes of the path hash (BLAKE3 output is
+/// uniformly distributed, so no extra mixing is needed).
+fn probe_start(hash: &PathHash) -> usize {
+    u64::from_le_bytes(hash[..8].try_into().unwrap()) as usize
+}
+
+/// View a #[repr(C)] struct as raw bytes for writing.
+unsafe fn as_bytes<T>(v: &T) -> &[u8] {
+    std::slice::from_raw_parts(v as *const T as *const u8, std::mem::size_of::<T>())
+}
+
+/// Read-only manifest backed by a single mmap of a flat snapshot
+///
+/// Lookups and iteration operate directly over the mapping; nothing is
+/// parsed or copied at open time beyond header validation.
+pub struct FlatManifest {
+    mmap: Mmap,
+    entry_count: usize,
+    slot_count: usize,
+    records_off: usize,
+    index_off: usize,
+    strtab_off: usize,
+    strtab_len: usize,
+}
+
+impl FlatManifest {
+    /// Open a flat snapshot via mmap
+    ///
+    /// Only the 64-byte header is touched; records and paths fault in
+    /// on first access.
+    pub fn open<P: AsRef<Path>>(path: P) -> Result<Self> {
+        let file = File::open(path.as_ref())?;
+        // SAFETY: snapshots are written atomically via rename and never
+        // modified in place, so the mapping is stable for our lifetime.
+        let mmap = unsafe { Mmap::map(&file)? };
+        if mmap.len() < HEADER_SIZE {
+            return Err(ManifestError::Flat("file too small for header".into()));
+        }
+        // SAFETY: bounds checked above; FlatHeader is #[repr(C)] plain
+        // integers and the mapping is page-aligned.
+        let header = unsafe { &*(mmap.as_ptr() as *const FlatHeader) };
+        if header.magic != FLAT_MAGIC {
+            return Err(ManifestError::Flat("bad magic".into()));
+        }
+        if header.version != FLAT_VERSION {
+            return Err(ManifestError::Flat(format!(
+                "unsupported version {}",
+                header.version
+            )));
+        }
+
+        let entry_count = header.entry_count as usize;
+        let slot_count = header.slot_count as usize;
+        let records_off = header.records_off as usize;
+        let index_off = header.index_off as usize;
+        let strtab_off = header.strtab_off as usize;
+        let strtab_len = header.strtab_len as usize;
+
+        // Validate section layout once so every accessor can trust it.
+        let records_end = records_off
+            .checked_add(entry_count.checked_mul(RECORD_SIZE).unwrap_or(usize::MAX))
+            .unwrap_or(usize::MAX);
+        let index_end = index_off
+            .checked_add(slot_count.checked_mul(SLOT_SIZE).unwrap_or(usize::MAX))
+            .unwrap_or(usize::MAX);
+        let strtab_end = strtab_off.checked_add(strtab_len).unwrap_or(usize::MAX);
+        if records_off % 8 != 0
+            || index_off % 4 != 0
+            || records_end > index_off
+            || index_end > strtab_off
+            || strtab_end > mmap.len()
+            || (slot_count > 0 && !slot_count.is_power_of_two())
+        {
+            return Err(ManifestError::Flat("corrupt section layout".into()));
+        }
+
+        Ok(Self {
+            mmap,
+            entry_count,
+            slot_count,
+            records_off,
+            index_off,
+            strtab_off,
+            strtab_len,
+        })
+    }
+
+    fn records(&self) -> &[FlatRecord] {
+        // SAFETY: bounds and 8-alignment validated in open(); FlatRecord
+        // contains only integer fields, so every bit pattern is valid.
+        unsafe {
+            std::slice::from_raw_parts(
+                self.mmap.as_ptr().add(self.records_off) as *const FlatRecord,
+                self.entry_count,
+            )
+        }
+    }
+
+    fn index(&self) -> &[u8] {
+        &self.mmap[self.index_off..self.index_off + self.slot_count * SLOT_SIZE]
+    }
+
+    fn slot(&self, i: usize) -> u32 {
+        let raw = &self.index()[i * SLOT_SIZE..(i + 1) * SLOT_SIZE];
+        u32::from_le_bytes(raw.try_into().unwrap())
+    }
+
+    /// Resolve a record's path from the string table
+    fn path_of(&self, rec: &FlatRecord) -> Option<&str> {
+        let start = self.strtab_off + rec.path_off as usize;
+        let end = start + rec.path_len as usize;
+        if rec.path_len == 0 || end > self.strtab_off + self.strtab_len {
+            return None;
+        }
+        std::str::from_utf8(&self.mmap[start..end]).ok()
+    }
+
+    /// Get an entry by path
+    pub fn get(&self, path: &str) -> Option<&VnodeEntry> {
+        let hash = compute_path_hash(path);
+        self.get_by_hash(&hash)
+    }
+
+    /// Get an entry by path hash
+    pub fn get_by_hash(&self, hash: &PathHash) -> Option<&VnodeEntry> {
+        if self.slot_count == 0 {
+            return None;
+        }
+        let mask = self.slot_count - 1;
+        let records = self.records();
+        let mut slot = probe_start(hash) & mask;
+        // The writer keeps load factor <= 0.5, so an empty slot always
+        // terminates the probe.
+        for _ in 0..self.slot_count {
+            let v = self.slot(slot);
+            if v == 0 {
+                return None;
+            }
+            if let Some(rec) = records.get(v as usize - 1) {
+                if rec.path_hash == *hash {
+                    return Some(&rec.vnode);
+                }
+            }
+            slot = (slot + 1) & mask;
+        }
+        None
+    }
+
+    /// Check if a path exists in the manifest
+    pub fn contains(&self, path: &str) -> bool {
+        self.get(path).is_some()
+    }
+
+    /// Get the number of entries
+    pub fn len(&self) -> usize {
+        self.entry_count
+    }
+
+    /// Check if the manifest is empty
+    pub fn is_empty(&self) -> bool {
+        self.entry_count == 0
+    }
+
+    /// Iterate over all entries with their paths
+    pub fn iter(&self) -> impl Iterator<Item = (&str, &VnodeEntry)> {
+        self.records()
+            .iter()
+            .filter_map(|rec| self.path_of(rec).map(|p| (p, &rec.vnode)))
+    }
+
+    /// Iterate over all paths
+    pub fn paths(&self) -> impl Iterator<Item = &str> {
+        self.records().iter().filter_map(|rec| self.path_of(rec))
+    }
+
+    /// Get manifest statistics
+    pub fn stats(&self) -> ManifestStats {
+        let mut stats = ManifestStats::default();
+        for rec in self.records() {
+            if rec.vnode.is_dir() {
+                stats.dir_count += 1;
+            } else {
+                stats.file_count += 1;
+                stats.total_size += rec.vnode.size;
+            }
+        }
+        stats
+    }
+
+    /// Hydrate into an owned in-memory [`Manifest`]
+    ///
+    /// O(entries) — only for compatibility paths that mutate the manifest.
+    pub fn to_manifest(&self) -> Manifest {
+        let mut manifest = Manifest::new();
+        for rec in self.records() {
+            manifest.entries.insert(rec.path_hash, rec.vnode.clone());
+            if let Some(p) = self.path_of(rec) {
+                manifest.paths.insert(rec.path_hash, p.to_string());
+            }
+        }
+        manifest
+    }
+}
+
+impl std::fmt::Debug for FlatManifest {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("FlatManifest")
+            .field("entry_count", &self.entry_count)
+            .field("slot_count", &self.slot_count)
+            .field("mapped_bytes", &self.mmap.len())
+            .finish()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use tempfile::TempDir;
+
+    fn sample_manifest() -> Manifest {
+        let mut manifest = Manifest::new();
+        manifest.insert(
+            "/app/main.py",
+            VnodeEntry::new_file([0xABu8; 32], 1024, 1706448000, 0o644),
+        );
+        manifest.insert(
+            "/app/lib/util.py",
+            VnodeEntry::new_file([0xCDu8; 32], 2048, 1706448001, 0o644),
+        );
+        manifest.insert("/app/lib", VnodeEntry::new_directory(1706448002, 0o755));
+        manifest
+    }
+
+    #[test]
+    fn test_flat_round_trip() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("test.vrmf");
+
+        let manifest = sample_manifest();
+        manifest.save_flat(&path).unwrap();
+
+        let flat = FlatManifest::open(&path).unwrap();
+        assert_eq!(flat.len(), 3);
+
+        let entry = flat.get("/app/main.py").unwrap();
+        assert_eq!(entry.content_hash, [0xABu8; 32]);
+        assert_eq!(entry.size, 1024);
+
+        let hash = compute_path_hash("/app/lib/util.py");
+        assert_eq!(flat.get_by_hash(&hash).unwrap().size, 2048);
+
+        assert!(flat.get("/app/missing.py").is_none());
+        assert!(flat.contains("/app/lib"));
+    }
+
+    #[test]
+    fn test_flat_iter_matches_source() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("test.vrmf");
+
+        let manifest = sample_manifest();
+        manifest.save_flat(&path).unwrap();
+
+        let flat = FlatManifest::open(&path).unwrap();
+        let mut flat_paths: Vec<&str> = flat.paths().collect();
+        let mut src_paths: Vec<&str> = manifest.paths().collect();
+        flat_paths.sort_unstable();
+        src_paths.sort_unstable();
+        assert_eq!(flat_paths, src_paths);
+
+        for (p, entry) in flat.iter() {
+            assert_eq!(manifest.get(p), Some(entry));
+        }
+
+        let stats = flat.stats();
+        assert_eq!(stats.file_count, 2);
+        assert_eq!(stats.dir_count, 1);
+        assert_eq!(stats.total_size, 3072);
+    }
+
+    #[test]
+    fn test_flat_empty_manifest() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("empty.vrmf");
+
+        Manifest::new().save_flat(&path).unwrap();
+
+        let flat = FlatManifest::open(&path).unwrap();
+        assert!(flat.is_empty());
+        assert!(flat.get("/anything").is_none());
+        assert_eq!(flat.iter().count(), 0);
+    }
+
+    #[test]
+    fn test_manifest_load_hydrates_flat() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("test.vrmf");
+
+        let manifest = sample_manifest();
+        manifest.save_flat(&path).unwrap();
+
+        // Legacy consumers go through Manifest::load transparently.
+        let loaded = Manifest::load(&path).unwrap();
+        assert_eq!(loaded.len(), 3);
+        assert_eq!(loaded.get("/app/main.py"), manifest.get("/app/main.py"));
+    }
+
+    #[test]
+    fn test_flat_rejects_garbage() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("garbage.vrmf");
+        std::fs::write(&path, b"not a flat manifest at all").unwrap();
+        assert!(FlatManifest::open(&path).is_err());
+    }
+
+    #[test]
+    fn test_flat_many_entries() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("big.vrmf");
+
+        let mut manifest = Manifest::new();
+        for i in 0..1000 {
+            let mut hash = [0u8; 32];
+            hash[..8].copy_from_slice(&(i as u64).to_le_bytes());
+            manifest.insert(
+                &format!("/data/file_{i}.bin"),
+                VnodeEntry::new_file(hash, i as u64, 0, 0o644),
+            );
+        }
+        manifest.save_flat(&path).unwrap();
+
+        let flat = FlatManifest::open(&path).unwrap();
+        assert_eq!(flat.len(), 1000);
+        for i in (0..1000).step_by(37) {
+            let entry = flat.get(&format!("/data/file_{i}.bin")).unwrap();
+            assert_eq!(entry.size, i as u64);
+        }
+        assert!(flat.get("/data/file_1000.bin").is_none());
+    }
+}
@@ -10,9 +10,11 @@
 //! - `Manifest`: In-memory HashMap with rkyv file persistence
 //! - `LmdbManifest`: LMDB-backed with ACID transactions (RFC-0039)
 
+pub mod flat;
 pub mod lmdb;
 pub mod tier;
 
+pub use flat::FlatManifest;
 pub use lmdb::{AssetTier, LmdbError, LmdbManifest, LmdbResult, ManifestEntry};
 pub use tier::{classify_tier, TierClassifier, DEFAULT_TIER1_PATTERNS, DEFAULT_TIER2_PATTERNS};
 
@@ -38,6 +40,9 @@ pub enum ManifestError {
 
     #[error("Path not found: {0}")]
     PathNotFound(String),
+
+    #[error("Flat snapshot error: {0}")]
+    Flat(String),
 }
 
 pub type Result<T> = std::result::Result<T, ManifestError>;
@@ -85,6 +90,7 @@ pub enum VnodeFlags {
     Debug, Clone, PartialEq, Eq, Serialize, Deserialize, Archive, rkyv::Serialize, rkyv::Deserialize,
 )]
 #[rkyv(derive(Debug))]
+#[repr(C)]
 pub struct VnodeEntry {
     /// BLAKE3 hash of the file content (stored in CAS)
     pub content_hash: Blake3Hash,
@@ -275,11 +281,20 @@ impl Manifest {
     }
 
     /// Load a manifest from a file
+    ///
+    /// Accepts both the rkyv format written by [`Manifest::save`] and the
+    /// flat snapshot format written by [`Manifest::save_flat`] (hydrated
+    /// into the in-memory HashMap). Consumers that want zero-copy access
+    /// should open flat snapshots via [`FlatManifest::open`] instead.
     pub fn load<P: AsRef<Path>>(path: P) -> Result<Self> {
+        let path = path.as_ref();
         let file = File::open(path)?;
         let mut reader = BufReader::new(file);
         let mut data = Vec::new();
         std::io::Read::read_to_end(&mut reader, &mut data)?;
+        if data.starts_with(&flat::FLAT_MAGIC) {
+            return FlatManifest::open(path).map(|f| f.to_manifest());
+        }
         let manifest = rkyv::from_bytes::<Self, rkyv::rancor::Error>(&data)
             .map_err(|e| ManifestError::Rkyv(e.to_string()))?;
         Ok(manifest)
@@ -9,11 +9,13 @@ use std::sync::Arc;
 
 use dashmap::DashMap;
 use heed::types::{Bytes, SerdeBincode, Str};
-use heed::{Database, Env, EnvOpenOptions};
+use heed::{Database, DatabaseFlags, Env, EnvOpenOptions};
 use serde::{Deserialize, Serialize};
 use thiserror::Error;
 use tracing::debug;
 
+use vrift_cas::Blake3Hash;
+
 use crate::{compute_path_hash, PathHash, VnodeEntry};
 
 /// LMDB Manifest errors
@@ -85,6 +87,11 @@ pub struct LmdbManifest {
     /// Path hash → original path string database
     paths_db: Database<Bytes, Str>,
 
+    /// Content hash → path hash reverse index (DUP_SORT: one key, many
+    /// path-hash values). Maintained in the same write transaction as
+    /// `entries_db`, so it can never disagree with the forward mapping.
+    rmap_db: Database<Bytes, Bytes>,
+
     /// Delta layer for uncommitted modifications
     delta: Arc<DashMap<PathHash, DeltaEntry>>,
 
@@ -119,14 +126,42 @@ impl LmdbManifest {
             EnvOpenOptions::new()
                 .map_size(Self::DEFAULT_MAP_SIZE)
                 .max_readers(Self::MAX_READERS)
-                .max_dbs(2)
+                .max_dbs(3)
                 .open(path)?
         };
 
         // Open databases
         let mut wtxn = env.write_txn()?;
-        let entries_db = env.create_database(&mut wtxn, Some("entries"))?;
-        let paths_db = env.create_database(&mut wtxn, Some("paths"))?;
+        let entries_db: Database<Bytes, SerdeBincode<ManifestEntry>> =
+            env.create_database(&mut wtxn, Some("entries"))?;
+        let paths_db: Database<Bytes, Str> = env.create_database(&mut wtxn, Some("paths"))?;
+        let rmap_db = env
+            .database_options()
+            .types::<Bytes, Bytes>()
+            .flags(DatabaseFlags::DUP_SORT)
+            .name("rmap")
+            .create(&mut wtxn)?;
+
+        // Backfill: manifests created before the reverse index existed have
+        // entries but an empty rmap — rebuild it once, in the same txn
+        if rmap_db.is_empty(&wtxn)? && !entries_db.is_empty(&wtxn)? {
+            let mut pairs = Vec::new();
+            {
+                let mut iter = entries_db.iter(&wtxn)?;
+                while let Some(Ok((hash_bytes, entry))) = iter.next() {
+                    if Self::is_indexable(&entry.vnode.content_hash) {
+                        let hash: PathHash = hash_bytes.try_into().unwrap_or([0u8; 32]);
+                        pairs.push((entry.vnode.content_hash, hash));
+                    }
+                }
+            }
+            for (chash, phash) in &pairs {
+                rmap_db.put(&mut wtxn, &chash[..], &phash[..])?;
+            }
+            if !pairs.is_empty() {
+                debug!("Backfilled reverse index with {} entries", pairs.len());
+            }
+        }
         wtxn.commit()?;
 
         debug!("Opened LMDB manifest at {:?}", path);
@@ -135,6 +170,7 @@ impl LmdbManifest {
             env,
             entries_db,
             paths_db,
+            rmap_db,
             delta: Arc::new(DashMap::new()),
             delta_paths: Arc::new(DashMap::new()),
         })
@@ -157,6 +193,19 @@ impl LmdbManifest {
         self.delta_paths.insert(hash, path.to_string());
     }
 
+    /// Begin a bulk load: thousands of inserts batched into one write txn.
+    ///
+    /// Unlike `insert()`, entries staged on a [`BulkWriter`] skip the delta
+    /// layer and are not visible to readers until its `commit()` — intended
+    /// for ingest-time population, where the per-entry DashMap traffic and
+    /// random-order B-tree puts of the delta path dominate.
+    pub fn begin_bulk(&self) -> BulkWriter<'_> {
+        BulkWriter {
+            manifest: self,
+            staged: Vec::new(),
+        }
+    }
+
     /// Get an entry by path (checks delta first, then base)
     pub fn get(&self, path: &str) -> LmdbResult<Option<ManifestEntry>> {
         let hash = compute_path_hash(path);
@@ -226,6 +275,109 @@ impl LmdbManifest {
         Ok(None)
     }
 
+    /// Directories and symlink placeholders carry an all-zero content hash;
+    /// indexing those would pile every one of them under a single rmap key.
+    fn is_indexable(content_hash: &Blake3Hash) -> bool {
+        content_hash != &[0u8; 32]
+    }
+
+    /// Move a path's rmap pair from `old` to `new` content hash (either
+    /// side may be absent). Must run inside the caller's write txn.
+    fn update_rmap(
+        &self,
+        wtxn: &mut heed::RwTxn,
+        path_hash: &PathHash,
+        old: Option<&Blake3Hash>,
+        new: Option<&Blake3Hash>,
+    ) -> LmdbResult<()> {
+        if old == new {
+            return Ok(());
+        }
+        if let Some(old_chash) = old {
+            if Self::is_indexable(old_chash) {
+                self.rmap_db
+                    .delete_one_duplicate(wtxn, &old_chash[..], &path_hash[..])?;
+            }
+        }
+        if let Some(new_chash) = new {
+            if Self::is_indexable(new_chash) {
+                self.rmap_db.put(wtxn, &new_chash[..], &path_hash[..])?;
+            }
+        }
+        Ok(())
+    }
+
+    /// All paths whose current entry references `content_hash` (delta
+    /// merged over the base reverse index).
+    ///
+    /// This is the "which targets consume this blob" query: GC diagnostics,
+    /// pack compaction, and hardlink accounting all sit on top of it.
+    pub fn paths_for_content_hash(&self, content_hash: &Blake3Hash) -> LmdbResult<Vec<String>> {
+        let mut paths = Vec::new();
+        let mut overridden: std::collections::HashSet<PathHash> = std::collections::HashSet::new();
+
+        // Delta layer: uncommitted entries win; any delta key shadows its
+        // base rmap pair (the pair reflects the pre-delta content hash)
+        for entry in self.delta.iter() {
+            overridden.insert(*entry.key());
+            if let DeltaEntry::Modified(m) = entry.value() {
+                if m.vnode.content_hash == *content_hash {
+                    if let Some(path_ref) = self.delta_paths.get(entry.key()) {
+                        paths.push(path_ref.value().clone());
+                    }
+                }
+            }
+        }
+
+        // Base layer: range-scan the duplicates under this content hash
+        let rtxn = self.env.read_txn()?;
+        if let Some(iter) = self.rmap_db.get_duplicates(&rtxn, &content_hash[..])? {
+            for pair in iter {
+                let (_, phash_bytes) = pair?;
+                let path_hash: PathHash = phash_bytes.try_into().unwrap_or([0u8; 32]);
+                if overridden.contains(&path_hash) {
+                    continue;
+                }
+                if let Some(path) = self.paths_db.get(&rtxn, &path_hash)? {
+                    paths.push(path.to_string());
+                }
+            }
+        }
+
+        Ok(paths)
+    }
+
+    /// Number of manifest entries referencing `content_hash` (delta merged).
+    ///
+    /// O(dup-count) cursor walk, no path-string materialization — cheap
+    /// enough for sweep() to consult per candidate blob.
+    pub fn blob_ref_count(&self, content_hash: &Blake3Hash) -> LmdbResult<u64> {
+        let mut count = 0u64;
+        let mut overridden: std::collections::HashSet<PathHash> = std::collections::HashSet::new();
+
+        for entry in self.delta.iter() {
+            overridden.insert(*entry.key());
+            if let DeltaEntry::Modified(m) = entry.value() {
+                if m.vnode.content_hash == *content_hash {
+                    count += 1;
+                }
+            }
+        }
+
+        let rtxn = self.env.read_txn()?;
+        if let Some(iter) = self.rmap_db.get_duplicates(&rtxn, &content_hash[..])? {
+            for pair in iter {
+                let (_, phash_bytes) = pair?;
+                let path_hash: PathHash = phash_bytes.try_into().unwrap_or([0u8; 32]);
+                if !overridden.contains(&path_hash) {
+                    count += 1;
+                }
+            }
+        }
+
+        Ok(count)
+    }
+
     /// Commit delta layer to base layer (ACID transaction)
     pub fn commit(&self) -> LmdbResult<()> {
         if self.delta.is_empty() {
@@ -234,19 +386,37 @@ impl LmdbManifest {
 
         let mut wtxn = self.env.write_txn()?;
 
-        // Apply delta to base
-        for entry in self.delta.iter() {
-            let hash = entry.key();
+        // Apply delta to base in sorted key order — LMDB's B-tree rewards
+        // ascending puts with better page locality than DashMap's hash order
+        let mut hashes: Vec<PathHash> = self.delta.iter().map(|e| *e.key()).collect();
+        hashes.sort_unstable();
+
+        for hash in &hashes {
+            let Some(entry) = self.delta.get(hash) else {
+                continue;
+            };
+            // Old content hash (if any) so the reverse index stays exact
+            let old_chash = self
+                .entries_db
+                .get(&wtxn, hash)?
+                .map(|old| old.vnode.content_hash);
             match entry.value() {
                 DeltaEntry::Modified(manifest_entry) => {
                     self.entries_db.put(&mut wtxn, hash, manifest_entry)?;
                     if let Some(path_ref) = self.delta_paths.get(hash) {
                         self.paths_db.put(&mut wtxn, hash, path_ref.value())?;
                     }
+                    self.update_rmap(
+                        &mut wtxn,
+                        hash,
+                        old_chash.as_ref(),
+                        Some(&manifest_entry.vnode.content_hash),
+                    )?;
                 }
                 DeltaEntry::Deleted => {
                     self.entries_db.delete(&mut wtxn, hash)?;
                     self.paths_db.delete(&mut wtxn, hash)?;
+                    self.update_rmap(&mut wtxn, hash, old_chash.as_ref(), None)?;
                 }
             }
         }
@@ -372,6 +542,78 @@ impl LmdbManifest {
     }
 }
 
+/// Bulk loader created by [`LmdbManifest::begin_bulk`].
+///
+/// Stages entries in memory and flushes them in a single LMDB write
+/// transaction, with keys sorted ascending for append-friendly B-tree
+/// behavior. On a later duplicate path the last insert wins.
+pub struct BulkWriter<'a> {
+    manifest: &'a LmdbManifest,
+    staged: Vec<(PathHash, ManifestEntry, String)>,
+}
+
+impl BulkWriter<'_> {
+    /// Stage an entry for the bulk transaction (not yet visible to readers)
+    pub fn insert(&mut self, path: &str, vnode: VnodeEntry, tier: AssetTier) {
+        let hash = compute_path_hash(path);
+        let entry = ManifestEntry {
+            vnode,
+            tier,
+            stale: false,
+        };
+        self.staged.push((hash, entry, path.to_string()));
+    }
+
+    /// Number of staged entries
+    pub fn len(&self) -> usize {
+        self.staged.len()
+    }
+
+    /// Whether nothing has been staged
+    pub fn is_empty(&self) -> bool {
+        self.staged.is_empty()
+    }
+
+    /// Write all staged entries in one transaction. Returns the entry count.
+    pub fn commit(mut self) -> LmdbResult<usize> {
+        if self.staged.is_empty() {
+            return Ok(0);
+        }
+
+        // Sort ascending; keep the LAST insert for duplicate keys
+        self.staged.sort_by(|a, b| a.0.cmp(&b.0));
+
+        let mut wtxn = self.manifest.env.write_txn()?;
+        let mut written = 0usize;
+        let mut iter = self.staged.iter().peekable();
+        while let Some((hash, entry, path)) = iter.next() {
+            if let Some((next_hash, _, _)) = iter.peek() {
+                if next_hash == hash {
+                    continue; // superseded by a later insert of the same path
+                }
+            }
+            let old_chash = self
+                .manifest
+                .entries_db
+                .get(&wtxn, hash)?
+                .map(|old| old.vnode.content_hash);
+            self.manifest.entries_db.put(&mut wtxn, hash, entry)?;
+            self.manifest.paths_db.put(&mut wtxn, hash, path)?;
+            self.manifest.update_rmap(
+                &mut wtxn,
+                hash,
+                old_chash.as_ref(),
+                Some(&entry.vnode.content_hash),
+            )?;
+            written += 1;
+        }
+        wtxn.commit()?;
+
+        debug!("Bulk-committed {} entries to LMDB", written);
+        Ok(written)
+    }
+}
+
 /// Statistics about the LMDB manifest
 #[derive(Debug, Clone, Default)]
 pub struct ManifestStats {
@@ -425,6 +667,54 @@ mod tests {
         assert_eq!(retrieved.tier, AssetTier::Tier1Immutable);
     }
 
+    #[test]
+    fn test_lmdb_manifest_bulk_insert() {
+        let temp = TempDir::new().unwrap();
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+
+        let mut bulk = manifest.begin_bulk();
+        for i in 0..100u32 {
+            let hash = [i as u8; 32];
+            bulk.insert(
+                &format!("/src/file_{}.rs", i),
+                VnodeEntry::new_file(hash, i as u64, 0, 0o644),
+                AssetTier::Tier2Mutable,
+            );
+        }
+        assert_eq!(bulk.len(), 100);
+
+        // Not visible before commit (bypasses delta layer)
+        assert!(manifest.get("/src/file_7.rs").unwrap().is_none());
+
+        assert_eq!(bulk.commit().unwrap(), 100);
+        let entry = manifest.get("/src/file_7.rs").unwrap().unwrap();
+        assert_eq!(entry.vnode.content_hash, [7u8; 32]);
+        assert_eq!(manifest.len().unwrap(), 100);
+    }
+
+    #[test]
+    fn test_lmdb_manifest_bulk_last_insert_wins() {
+        let temp = TempDir::new().unwrap();
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+
+        let mut bulk = manifest.begin_bulk();
+        bulk.insert(
+            "/dup.txt",
+            VnodeEntry::new_file([0x11u8; 32], 100, 0, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        bulk.insert(
+            "/dup.txt",
+            VnodeEntry::new_file([0x22u8; 32], 200, 0, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        assert_eq!(bulk.commit().unwrap(), 1);
+
+        let entry = manifest.get("/dup.txt").unwrap().unwrap();
+        assert_eq!(entry.vnode.content_hash, [0x22u8; 32]);
+        assert_eq!(entry.vnode.size, 200);
+    }
+
     #[test]
     fn test_lmdb_manifest_delta_override() {
         let temp = TempDir::new().unwrap();
@@ -473,6 +763,95 @@ mod tests {
         assert!(manifest.get("/to_delete.txt").unwrap().is_none());
     }
 
+    #[test]
+    fn test_reverse_index_paths_and_ref_count() {
+        let temp = TempDir::new().unwrap();
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+
+        let shared = [0xAAu8; 32];
+        manifest.insert(
+            "/a.o",
+            VnodeEntry::new_file(shared, 10, 0, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        manifest.insert(
+            "/b.o",
+            VnodeEntry::new_file(shared, 10, 0, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        manifest.insert(
+            "/c.o",
+            VnodeEntry::new_file([0xBBu8; 32], 20, 0, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+
+        // Visible from the delta layer before commit
+        assert_eq!(manifest.blob_ref_count(&shared).unwrap(), 2);
+
+        manifest.commit().unwrap();
+        let mut paths = manifest.paths_for_content_hash(&shared).unwrap();
+        paths.sort();
+        assert_eq!(paths, vec!["/a.o".to_string(), "/b.o".to_string()]);
+        assert_eq!(manifest.blob_ref_count(&shared).unwrap(), 2);
+        assert_eq!(manifest.blob_ref_count(&[0xBBu8; 32]).unwrap(), 1);
+
+        // Retarget /b.o to new content: rmap pair moves on commit
+        manifest.insert(
+            "/b.o",
+            VnodeEntry::new_file([0xCCu8; 32], 30, 0, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        assert_eq!(manifest.blob_ref_count(&shared).unwrap(), 1);
+        manifest.commit().unwrap();
+        assert_eq!(
+            manifest.paths_for_content_hash(&shared).unwrap(),
+            vec!["/a.o".to_string()]
+        );
+        assert_eq!(manifest.blob_ref_count(&[0xCCu8; 32]).unwrap(), 1);
+
+        // Remove the last reference
+        manifest.remove("/a.o");
+        manifest.commit().unwrap();
+        assert!(manifest.paths_for_content_hash(&shared).unwrap().is_empty());
+        assert_eq!(manifest.blob_ref_count(&shared).unwrap(), 0);
+    }
+
+    #[test]
+    fn test_reverse_index_backfill_on_open() {
+        let temp = TempDir::new().unwrap();
+        let path = temp.path().join("manifest");
+        let shared = [0x77u8; 32];
+
+        {
+            let manifest = LmdbManifest::open(&path).unwrap();
+            let mut bulk = manifest.begin_bulk();
+            bulk.insert(
+                "/x.rs",
+                VnodeEntry::new_file(shared, 1, 0, 0o644),
+                AssetTier::Tier2Mutable,
+            );
+            bulk.insert(
+                "/y.rs",
+                VnodeEntry::new_file(shared, 1, 0, 0o644),
+                AssetTier::Tier2Mutable,
+            );
+            bulk.commit().unwrap();
+
+            // Simulate a pre-rmap manifest by dropping the index
+            let mut wtxn = manifest.env.write_txn().unwrap();
+            manifest.rmap_db.clear(&mut wtxn).unwrap();
+            wtxn.commit().unwrap();
+            assert_eq!(manifest.blob_ref_count(&shared).unwrap(), 0);
+        }
+
+        // Re-open rebuilds the reverse index from entries_db
+        let manifest = LmdbManifest::open(&path).unwrap();
+        assert_eq!(manifest.blob_ref_count(&shared).unwrap(), 2);
+        let mut paths = manifest.paths_for_content_hash(&shared).unwrap();
+        paths.sort();
+        assert_eq!(paths, vec!["/x.rs".to_string(), "/y.rs".to_string()]);
+    }
+
     #[test]
     fn test_tier_classification() {
         assert_eq!(AssetTier::default(), AssetTier::Tier2Mutable);
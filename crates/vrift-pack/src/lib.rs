@@ -253,6 +253,231 @@ impl PackWriter {
     }
 }
 
+// ============================================================================
+// Pack Set: mmap'd pack directory serving as a CasStore tier
+// ============================================================================
+
+/// All packs under `<cas_root>/packs/`, consulted as one read-only tier.
+///
+/// Each pack stays mmap'd with its index resident, so a lookup is a hash-map
+/// probe plus a page-cache read — no per-blob open. Attach to a `CasStore`
+/// via [`attach_pack_tier`] and `get`/`get_mmap`/`exists` fall through here
+/// on loose-blob misses.
+pub struct PackSet {
+    readers: Vec<PackReader>,
+}
+
+impl PackSet {
+    /// Directory holding packs, relative to the CAS root
+    pub const PACKS_DIR: &'static str = "packs";
+
+    /// Open every `*.pack` under `<cas_root>/packs/` (empty set if none)
+    pub fn open<P: AsRef<Path>>(cas_root: P) -> Result<Self> {
+        let packs_dir = cas_root.as_ref().join(Self::PACKS_DIR);
+        let mut readers = Vec::new();
+        if packs_dir.is_dir() {
+            for entry in std::fs::read_dir(&packs_dir)? {
+                let path = entry?.path();
+                if path.extension().is_some_and(|ext| ext == "pack") {
+                    match PackReader::open(&path) {
+                        Ok(reader) => readers.push(reader),
+                        Err(e) => {
+                            tracing::warn!("Skipping unreadable pack {:?}: {}", path, e);
+                        }
+                    }
+                }
+            }
+        }
+        Ok(Self { readers })
+    }
+
+    /// Zero-copy blob lookup across all packs
+    pub fn get_slice(&self, hash: &Blake3Hash) -> Option<&[u8]> {
+        self.readers
+            .iter()
+            .find(|r| r.contains(hash))
+            .and_then(|r| r.get(hash).ok())
+    }
+
+    /// Whether any pack holds this blob
+    pub fn contains(&self, hash: &Blake3Hash) -> bool {
+        self.readers.iter().any(|r| r.contains(hash))
+    }
+
+    /// Number of packs in the set
+    pub fn pack_count(&self) -> usize {
+        self.readers.len()
+    }
+
+    /// Total blobs across all packs
+    pub fn blob_count(&self) -> usize {
+        self.readers.iter().map(|r| r.len()).sum()
+    }
+}
+
+impl vrift_cas::PackTier for PackSet {
+    fn contains(&self, hash: &Blake3Hash) -> bool {
+        PackSet::contains(self, hash)
+    }
+
+    fn get(&self, hash: &Blake3Hash) -> Option<Vec<u8>> {
+        self.get_slice(hash).map(|s| s.to_vec())
+    }
+}
+
+/// Open the pack set under the store's root and attach it as the store's
+/// pack tier. Returns the number of packs found.
+pub fn attach_pack_tier(cas: &mut vrift_cas::CasStore) -> Result<usize> {
+    let set = PackSet::open(cas.root())?;
+    let count = set.pack_count();
+    cas.set_pack_tier(std::sync::Arc::new(set));
+    Ok(count)
+}
+
+// ============================================================================
+// Compaction: migrate cold small blobs into packs
+// ============================================================================
+
+/// Tuning for [`compact_small_blobs`]
+#[derive(Debug, Clone)]
+pub struct CompactionConfig {
+    /// Only blobs at or below this size are packed (default: 64KB)
+    pub max_blob_size: u64,
+    /// Only blobs whose mtime is at least this old are considered cold
+    /// (default: 24h; set to zero to pack everything eligible)
+    pub min_age: std::time::Duration,
+    /// Close a pack once its data section reaches this size (default: 64MB)
+    pub target_pack_bytes: u64,
+}
+
+impl Default for CompactionConfig {
+    fn default() -> Self {
+        Self {
+            max_blob_size: 64 * 1024,
+            min_age: std::time::Duration::from_secs(24 * 3600),
+            target_pack_bytes: 64 * 1024 * 1024,
+        }
+    }
+}
+
+/// Result of a compaction run
+#[derive(Debug, Default, Clone)]
+pub struct CompactionStats {
+    pub packs_written: u64,
+    pub blobs_packed: u64,
+    pub bytes_packed: u64,
+}
+
+/// Migrate cold small blobs from the loose fan-out into pack files.
+///
+/// Scans the loose tier, gathers blobs under `max_blob_size` whose mtime is
+/// older than `min_age`, and writes them into packs under
+/// `<cas_root>/packs/`. Loose copies are deleted only after their pack is
+/// durably on disk, so a crash mid-run leaves blobs readable (possibly in
+/// both tiers, which dedup tolerates). Intended to run from a maintenance
+/// thread or a scheduled `vrift` invocation; re-attach the pack tier (or
+/// reopen the [`PackSet`]) afterwards to serve the new packs.
+pub fn compact_small_blobs(
+    cas: &vrift_cas::CasStore,
+    config: &CompactionConfig,
+) -> Result<CompactionStats> {
+    let packs_dir = cas.root().join(PackSet::PACKS_DIR);
+    std::fs::create_dir_all(&packs_dir)?;
+
+    let now = std::time::SystemTime::now();
+    let mut stats = CompactionStats::default();
+    let mut seq = 0u32;
+    let run_id = std::time::UNIX_EPOCH
+        .elapsed()
+        .map(|d| d.as_secs())
+        .unwrap_or(0);
+
+    let mut writer: Option<PackWriter> = None;
+    let mut pending: Vec<Blake3Hash> = Vec::new();
+    let mut pending_bytes = 0u64;
+
+    let flush = |writer: Option<PackWriter>,
+                     pending: &mut Vec<Blake3Hash>,
+                     stats: &mut CompactionStats|
+     -> Result<()> {
+        let Some(w) = writer else { return Ok(()) };
+        let pack_path = w.finish()?;
+        // Durability barrier before deleting the loose copies
+        File::open(&pack_path)?.sync_all()?;
+        stats.packs_written += 1;
+        for hash in pending.drain(..) {
+            if let Err(e) = cas.delete(&hash) {
+                tracing::warn!(
+                    "Compaction: failed to remove loose blob {}: {}",
+                    vrift_cas::CasStore::hash_to_hex(&hash),
+                    e
+                );
+            }
+        }
+        Ok(())
+    };
+
+    for hash_res in cas.iter().map_err(|e| PackError::Io(io::Error::other(e)))? {
+        let hash = hash_res.map_err(|e| PackError::Io(io::Error::other(e)))?;
+        let Some(path) = cas.find_blob_path(&hash) else {
+            continue;
+        };
+        let Ok(meta) = std::fs::metadata(&path) else {
+            continue;
+        };
+        // Tiered blobs (.zst cold tier, CDC chunk indexes) intentionally
+        // don't hash to their filename — they'd trip the corruption check
+        // below, and they already live outside the loose hot tier anyway.
+        if vrift_cas::CasStore::is_compressed_blob(&path)
+            || vrift_cas::CasStore::is_chunked_blob(&path)
+        {
+            continue;
+        }
+        if meta.len() > config.max_blob_size {
+            continue;
+        }
+        let cold = meta
+            .modified()
+            .ok()
+            .and_then(|mtime| now.duration_since(mtime).ok())
+            .is_some_and(|age| age >= config.min_age);
+        if !cold {
+            continue;
+        }
+
+        // Verify on read — never pack a blob that doesn't match its name
+        let Ok(data) = std::fs::read(&path) else {
+            continue;
+        };
+        if vrift_cas::CasStore::compute_hash(&data) != hash {
+            tracing::warn!(
+                "Compaction: loose blob {} is corrupt, skipping",
+                vrift_cas::CasStore::hash_to_hex(&hash)
+            );
+            continue;
+        }
+
+        let w = writer.get_or_insert_with(|| {
+            let name = format!("pack-{}-{:04}.pack", run_id, seq);
+            seq += 1;
+            PackWriter::new(packs_dir.join(name))
+        });
+        w.add(hash, &data);
+        pending.push(hash);
+        pending_bytes += data.len() as u64;
+        stats.blobs_packed += 1;
+        stats.bytes_packed += data.len() as u64;
+
+        if pending_bytes >= config.target_pack_bytes {
+            flush(writer.take(), &mut pending, &mut stats)?;
+            pending_bytes = 0;
+        }
+    }
+
+    flush(writer.take(), &mut pending, &mut stats)?;
+    Ok(stats)
+}
+
 /// Profile-guided packing: records access order for optimal packing
 #[derive(Debug, Default, Serialize, Deserialize, Archive, rkyv::Serialize, rkyv::Deserialize)]
 #[rkyv(derive(Debug))]
@@ -292,6 +517,80 @@ impl AccessProfile {
     }
 }
 
+// ============================================================================
+// Warm pack: profile-ordered prefetch for cold-cache startup
+// ============================================================================
+
+/// Result of building a warm pack
+#[derive(Debug, Default, Clone)]
+pub struct WarmPackStats {
+    /// Blobs written to the pack, in profile access order
+    pub blobs: u64,
+    /// Total data bytes packed
+    pub bytes: u64,
+    /// Profile hashes that were not found in the CAS (stale profile entries)
+    pub missing: u64,
+}
+
+/// Build a pack containing exactly the blobs a recorded build touched,
+/// laid out in access order so one sequential read covers the whole
+/// startup working set. Profile entries missing from the CAS are counted
+/// and skipped — profiles go stale as builds change.
+pub fn build_warm_pack(
+    cas: &vrift_cas::CasStore,
+    profile: &AccessProfile,
+    output: &Path,
+) -> Result<WarmPackStats> {
+    if let Some(parent) = output.parent() {
+        std::fs::create_dir_all(parent)?;
+    }
+
+    let mut stats = WarmPackStats::default();
+    let mut writer = PackWriter::new(output);
+    for hash in &profile.access_order {
+        match cas.get(hash) {
+            Ok(data) => {
+                stats.blobs += 1;
+                stats.bytes += data.len() as u64;
+                writer.add(*hash, &data);
+            }
+            Err(_) => stats.missing += 1,
+        }
+    }
+    writer.finish()?;
+    Ok(stats)
+}
+
+/// Ask the kernel to read a file into the page cache ahead of use.
+/// Returns the file size. The request is advisory and asynchronous.
+pub fn readahead<P: AsRef<Path>>(path: P) -> Result<u64> {
+    let file = File::open(path.as_ref())?;
+    let len = file.metadata()?.len();
+
+    #[cfg(target_os = "linux")]
+    {
+        use std::os::unix::io::AsRawFd;
+        // WILLNEED queues async readahead over the whole file
+        unsafe {
+            libc::posix_fadvise(file.as_raw_fd(), 0, 0, libc::POSIX_FADV_WILLNEED);
+        }
+    }
+
+    #[cfg(target_os = "macos")]
+    {
+        use std::os::unix::io::AsRawFd;
+        let advisory = libc::radvisory {
+            ra_offset: 0,
+            ra_count: len.min(i32::MAX as u64) as libc::c_int,
+        };
+        unsafe {
+            libc::fcntl(file.as_raw_fd(), libc::F_RDADVISE, &advisory);
+        }
+    }
+
+    Ok(len)
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -327,6 +626,88 @@ mod tests {
         assert_eq!(retrieved2, data2);
     }
 
+    #[test]
+    fn test_compaction_and_pack_tier() {
+        let temp = TempDir::new().unwrap();
+        let mut cas = CasStore::new(temp.path()).unwrap();
+
+        // Small blobs, eligible; one large blob that must stay loose
+        let mut small_hashes = Vec::new();
+        for i in 0..20u8 {
+            let data = vec![i; 512];
+            small_hashes.push(cas.store(&data).unwrap());
+        }
+        let big = vec![0xEEu8; 128 * 1024];
+        let big_hash = cas.store(&big).unwrap();
+
+        let config = CompactionConfig {
+            min_age: std::time::Duration::ZERO,
+            ..CompactionConfig::default()
+        };
+        let stats = compact_small_blobs(&cas, &config).unwrap();
+        assert_eq!(stats.blobs_packed, 20);
+        assert_eq!(stats.packs_written, 1);
+
+        // Loose copies gone, large blob untouched
+        assert!(cas.find_blob_path(&small_hashes[0]).is_none());
+        assert!(cas.find_blob_path(&big_hash).is_some());
+
+        // Without the tier attached the packed blobs are invisible
+        assert!(!cas.exists(&small_hashes[0]));
+
+        let packs = attach_pack_tier(&mut cas).unwrap();
+        assert_eq!(packs, 1);
+        assert!(cas.exists(&small_hashes[0]));
+        for (i, hash) in small_hashes.iter().enumerate() {
+            assert_eq!(cas.get(hash).unwrap(), vec![i as u8; 512]);
+        }
+        let mapped = cas.get_mmap(&small_hashes[3]).unwrap();
+        assert_eq!(&mapped[..], &vec![3u8; 512][..]);
+    }
+
+    #[test]
+    fn test_compaction_respects_min_age() {
+        let temp = TempDir::new().unwrap();
+        let cas = CasStore::new(temp.path()).unwrap();
+        cas.store(b"fresh blob").unwrap();
+
+        // Everything is newer than an hour — nothing should move
+        let config = CompactionConfig {
+            min_age: std::time::Duration::from_secs(3600),
+            ..CompactionConfig::default()
+        };
+        let stats = compact_small_blobs(&cas, &config).unwrap();
+        assert_eq!(stats.blobs_packed, 0);
+        assert_eq!(stats.packs_written, 0);
+    }
+
+    #[test]
+    fn test_build_warm_pack_from_profile() {
+        let temp = TempDir::new().unwrap();
+        let cas = CasStore::new(temp.path().join("cas")).unwrap();
+
+        let h1 = cas.store(b"first touched").unwrap();
+        let h2 = cas.store(b"second touched").unwrap();
+
+        let mut profile = AccessProfile::default();
+        profile.record(h2);
+        profile.record(h1);
+        profile.record([0x99u8; 32]); // stale entry, not in CAS
+
+        let pack_path = temp.path().join("warm.pack");
+        let stats = build_warm_pack(&cas, &profile, &pack_path).unwrap();
+        assert_eq!(stats.blobs, 2);
+        assert_eq!(stats.missing, 1);
+
+        let reader = PackReader::open(&pack_path).unwrap();
+        assert_eq!(reader.get(&h1).unwrap(), b"first touched");
+        assert_eq!(reader.get(&h2).unwrap(), b"second touched");
+
+        // Advisory readahead must not fail on a regular file
+        let len = readahead(&pack_path).unwrap();
+        assert!(len > 0);
+    }
+
     #[test]
     fn test_access_profile() {
         let temp = TempDir::new().unwrap();
@@ -7,12 +7,14 @@
 //! - OverlayFS mounting (Linux only)
 //! - Namespace isolation (Linux only)
 
+use std::collections::HashMap;
 use std::fs;
 use std::path::{Path, PathBuf};
+use std::sync::Mutex;
 
 use thiserror::Error;
 use vrift_cas::CasStore;
-use vrift_manifest::Manifest;
+use vrift_manifest::{Manifest, VnodeEntry};
 
 #[derive(Error, Debug)]
 pub enum RuntimeError {
@@ -82,76 +84,317 @@ impl LinkFarm {
                     fs::create_dir_all(parent)?;
                 }
 
-                if entry.is_file() {
-                    // Find source blob in CAS
-                    let src_path = self
-                        .cas
-                        .blob_path_for_hash(&entry.content_hash)
-                        .ok_or_else(|| {
-                            RuntimeError::BlobNotFound(format!("{:?}", entry.content_hash))
-                        })?;
-
-                    // Create hard link: src (CAS) -> dest (Link Farm)
-                    // Remove existing file if present (idempotency/overwrite)
-                    if dest_path.exists() {
-                        fs::remove_file(&dest_path)?;
-                    }
+                link_entry(&self.cas, entry, &dest_path)?;
+            }
+        }
+        Ok(())
+    }
 
-                    if let Err(e) = fs::hard_link(&src_path, &dest_path) {
-                        // Fallback to symlink if hard link fails with EPERM or EXDEV
-                        if e.kind() == std::io::ErrorKind::PermissionDenied
-                            || e.raw_os_error() == Some(18)
-                        {
-                            tracing::debug!(
-                                "Hard link failed (EPERM/EXDEV), falling back to symlink: {} -> {}",
-                                src_path.display(),
-                                dest_path.display()
-                            );
-                            if let Err(se) = std::os::unix::fs::symlink(&src_path, &dest_path) {
-                                return Err(RuntimeError::Io(se));
-                            }
-                        } else {
-                            return Err(RuntimeError::Io(e));
-                        }
-                    }
+    /// Parallel eager population: directory tree in one sorted pass, then
+    /// reflink-first link fan-out on rayon's work-stealing pool.
+    ///
+    /// For builds that really do touch everything (release targets), eager
+    /// materialization is right but the serial loop in [`populate`] leaves
+    /// every core but one idle. Work is partitioned by parent directory so
+    /// each worker stays within one dentry neighborhood, and reflink support
+    /// is probed once per populate instead of paying a failed ioctl per file
+    /// on filesystems without it.
+    ///
+    /// [`populate`]: LinkFarm::populate
+    pub fn populate_parallel(&self, manifests: &[Manifest], target: &Path) -> Result<()> {
+        use rayon::prelude::*;
 
-                    // Apply metadata (mode, mtime)
-                    use std::os::unix::fs::PermissionsExt;
-                    if let Err(e) =
-                        fs::set_permissions(&dest_path, fs::Permissions::from_mode(entry.mode))
-                    {
-                        tracing::warn!(
-                            "Failed to set permissions on {}: {}",
-                            dest_path.display(),
-                            e
-                        );
-                    }
+        if !target.exists() {
+            fs::create_dir_all(target)?;
+        }
+
+        // Merge manifests in order (later manifests win, same as populate)
+        let mut merged: HashMap<&str, &VnodeEntry> = HashMap::new();
+        for manifest in manifests {
+            for (path_str, entry) in manifest.iter() {
+                if path_str == "/" {
+                    continue;
+                }
+                merged.insert(path_str, entry);
+            }
+        }
+
+        // One sorted pass over the directory tree: ancestors sort before
+        // descendants, so each create_dir_all is mostly a stat hit
+        let mut dirs: std::collections::BTreeSet<PathBuf> = std::collections::BTreeSet::new();
+        let mut by_dir: HashMap<PathBuf, Vec<(&str, &VnodeEntry)>> = HashMap::new();
+        for (path_str, entry) in merged {
+            let dest_path = target.join(path_str.trim_start_matches('/'));
+            if entry.is_dir() {
+                dirs.insert(dest_path);
+            } else {
+                let parent = dest_path
+                    .parent()
+                    .map(Path::to_path_buf)
+                    .unwrap_or_else(|| target.to_path_buf());
+                dirs.insert(parent.clone());
+                by_dir.entry(parent).or_default().push((path_str, entry));
+            }
+        }
+        for dir in &dirs {
+            fs::create_dir_all(dir)?;
+        }
 
-                    // Note: Setting mtime requires filetime or similar,
-                    // skipping for MVP unless we add dependency.
-                    // But permissions are CRITICAL for execution.
-                } else if entry.is_symlink() {
-                    // Fetch symlink target from CAS
-                    let target_bytes = self
-                        .cas
-                        .get(&entry.content_hash)
-                        .map_err(RuntimeError::Cas)?;
-
-                    let target_path_str = String::from_utf8(target_bytes).map_err(|_| {
-                        RuntimeError::Overlay("Invalid UTF-8 in symlink target".into())
-                    })?;
-
-                    // Remove existing file if present
-                    if dest_path.exists() {
-                        fs::remove_file(&dest_path)?;
+        // One CoW-clone probe gates the per-file reflink attempts
+        let use_reflink = vrift_cas::reflink::probe_reflink_support(target);
+
+        // Directory-partitioned fan-out on the work-stealing pool
+        by_dir.par_iter().try_for_each(|(_, batch)| {
+            for (path_str, entry) in batch {
+                let dest_path = target.join(path_str.trim_start_matches('/'));
+                link_entry_with(&self.cas, entry, &dest_path, use_reflink)?;
+            }
+            Ok(())
+        })
+    }
+
+    /// Lazy population: create only the directory skeleton up front and defer
+    /// file/symlink materialization to first access.
+    ///
+    /// Eager population hardlinks every manifest entry before any build step
+    /// can run, but profiling shows most entries are never opened by a given
+    /// target — directories are the only thing that must exist for path
+    /// resolution to start. Returns a [`LazyLinkFarm`] that materializes
+    /// individual entries on demand (miss-driven) or in bulk.
+    pub fn populate_lazy(self, manifests: &[Manifest], target: &Path) -> Result<LazyLinkFarm> {
+        if !target.exists() {
+            fs::create_dir_all(target)?;
+        }
+
+        let mut pending: HashMap<String, VnodeEntry> = HashMap::new();
+        let mut skeleton: std::collections::HashSet<PathBuf> = std::collections::HashSet::new();
+
+        for manifest in manifests {
+            for (path_str, entry) in manifest.iter() {
+                if path_str == "/" {
+                    continue;
+                }
+                let relative_path = path_str.trim_start_matches('/');
+                let dest_path = target.join(relative_path);
+
+                if entry.is_dir() {
+                    skeleton.insert(dest_path);
+                } else {
+                    // Parent dirs belong to the skeleton even when the
+                    // manifest has no explicit directory entry for them
+                    if let Some(parent) = dest_path.parent() {
+                        skeleton.insert(parent.to_path_buf());
                     }
+                    // Later manifests overwrite earlier ones, same as populate()
+                    pending.insert(path_str.to_string(), entry.clone());
+                }
+            }
+        }
+
+        for dir in &skeleton {
+            fs::create_dir_all(dir)?;
+        }
 
-                    std::os::unix::fs::symlink(target_path_str, &dest_path)
-                        .map_err(RuntimeError::Io)?;
+        Ok(LazyLinkFarm {
+            cas: self.cas,
+            target: target.to_path_buf(),
+            pending: Mutex::new(pending),
+        })
+    }
+}
+
+/// Like [`link_entry`], but attempts a reflink (CoW clone) first when the
+/// target filesystem supports it. Cross-device or otherwise failed clones
+/// fall through to the hardlink/symlink ladder.
+fn link_entry_with(
+    cas: &CasStore,
+    entry: &VnodeEntry,
+    dest_path: &Path,
+    try_reflink_first: bool,
+) -> Result<()> {
+    if try_reflink_first && entry.is_file() {
+        if let Some(src_path) = cas.blob_path_for_hash(&entry.content_hash) {
+            if dest_path.exists() {
+                fs::remove_file(dest_path)?;
+            }
+            if vrift_cas::reflink::try_reflink(&src_path, dest_path).is_ok() {
+                use std::os::unix::fs::PermissionsExt;
+                if let Err(e) =
+                    fs::set_permissions(dest_path, fs::Permissions::from_mode(entry.mode))
+                {
+                    tracing::warn!("Failed to set permissions on {}: {}", dest_path.display(), e);
                 }
+                return Ok(());
             }
         }
-        Ok(())
+    }
+    link_entry(cas, entry, dest_path)
+}
+
+/// Materialize a single manifest entry (file or symlink) at `dest_path`.
+///
+/// Hard link with symlink fallback on EPERM/EXDEV; mode bits applied after.
+fn link_entry(cas: &CasStore, entry: &VnodeEntry, dest_path: &Path) -> Result<()> {
+    if entry.is_file() {
+        // Find source blob in CAS
+        let src_path = cas
+            .blob_path_for_hash(&entry.content_hash)
+            .ok_or_else(|| RuntimeError::BlobNotFound(format!("{:?}", entry.content_hash)))?;
+
+        // Create hard link: src (CAS) -> dest (Link Farm)
+        // Remove existing file if present (idempotency/overwrite)
+        if dest_path.exists() {
+            fs::remove_file(dest_path)?;
+        }
+
+        if let Err(e) = fs::hard_link(&src_path, dest_path) {
+            // Fallback to symlink if hard link fails with EPERM or EXDEV
+            if e.kind() == std::io::ErrorKind::PermissionDenied || e.raw_os_error() == Some(18) {
+                tracing::debug!(
+                    "Hard link failed (EPERM/EXDEV), falling back to symlink: {} -> {}",
+                    src_path.display(),
+                    dest_path.display()
+                );
+                if let Err(se) = std::os::unix::fs::symlink(&src_path, dest_path) {
+                    return Err(RuntimeError::Io(se));
+                }
+            } else {
+                return Err(RuntimeError::Io(e));
+            }
+        }
+
+        // Apply metadata (mode, mtime)
+        use std::os::unix::fs::PermissionsExt;
+        if let Err(e) = fs::set_permissions(dest_path, fs::Permissions::from_mode(entry.mode)) {
+            tracing::warn!("Failed to set permissions on {}: {}", dest_path.display(), e);
+        }
+
+        // Note: Setting mtime requires filetime or similar,
+        // skipping for MVP unless we add dependency.
+        // But permissions are CRITICAL for execution.
+    } else if entry.is_symlink() {
+        // Fetch symlink target from CAS
+        let target_bytes = cas.get(&entry.content_hash).map_err(RuntimeError::Cas)?;
+
+        let target_path_str = String::from_utf8(target_bytes)
+            .map_err(|_| RuntimeError::Overlay("Invalid UTF-8 in symlink target".into()))?;
+
+        // Remove existing file if present
+        if dest_path.exists() {
+            fs::remove_file(dest_path)?;
+        }
+
+        std::os::unix::fs::symlink(target_path_str, dest_path).map_err(RuntimeError::Io)?;
+    }
+    Ok(())
+}
+
+/// A link farm whose directory skeleton exists but whose file links are
+/// materialized on demand.
+///
+/// Produced by [`LinkFarm::populate_lazy`]. Thread-safe: the miss path
+/// (inception layer or FUSE fallback via the daemon) and a background
+/// warm-up thread can materialize concurrently — each entry is linked at
+/// most once.
+pub struct LazyLinkFarm {
+    cas: CasStore,
+    target: PathBuf,
+    pending: Mutex<HashMap<String, VnodeEntry>>,
+}
+
+impl LazyLinkFarm {
+    /// Materialize a single entry by manifest key (e.g. `/src/main.rs`).
+    ///
+    /// Returns `Ok(true)` if a link was created, `Ok(false)` if the key was
+    /// unknown or already materialized.
+    pub fn materialize(&self, manifest_key: &str) -> Result<bool> {
+        let entry = {
+            let mut pending = self.pending.lock().unwrap();
+            match pending.remove(manifest_key) {
+                Some(e) => e,
+                None => return Ok(false),
+            }
+        };
+
+        let dest_path = self.target.join(manifest_key.trim_start_matches('/'));
+        if let Err(e) = link_entry(&self.cas, &entry, &dest_path) {
+            // Reinsert so a transient failure (e.g. blob still being
+            // ingested) stays materializable instead of being lost.
+            self.pending
+                .lock()
+                .unwrap()
+                .insert(manifest_key.to_string(), entry);
+            return Err(e);
+        }
+        Ok(true)
+    }
+
+    /// Materialize every pending entry whose `VnodeEntry` matches `pred`.
+    ///
+    /// Used for profile-guided warm-up: callers pass a predicate over the
+    /// AccessProfile's hot hash set so the recorded working set is linked
+    /// before the build starts and everything else stays deferred.
+    ///
+    /// Per-entry failures don't abort the pass: every selected entry is
+    /// attempted, failed ones are put back in the pending set, and the
+    /// first error is returned after the loop (with the success count
+    /// already applied on disk).
+    pub fn materialize_where<F>(&self, pred: F) -> Result<usize>
+    where
+        F: Fn(&VnodeEntry) -> bool,
+    {
+        let selected: Vec<(String, VnodeEntry)> = {
+            let mut pending = self.pending.lock().unwrap();
+            let keys: Vec<String> = pending
+                .iter()
+                .filter(|(_, e)| pred(e))
+                .map(|(k, _)| k.clone())
+                .collect();
+            keys.into_iter()
+                .filter_map(|k| pending.remove(&k).map(|e| (k, e)))
+                .collect()
+        };
+
+        let mut count = 0;
+        let mut first_err = None;
+        let mut failed: Vec<(String, VnodeEntry)> = Vec::new();
+        for (key, entry) in selected {
+            let dest_path = self.target.join(key.trim_start_matches('/'));
+            match link_entry(&self.cas, &entry, &dest_path) {
+                Ok(()) => count += 1,
+                Err(e) => {
+                    if first_err.is_none() {
+                        first_err = Some(e);
+                    }
+                    failed.push((key, entry));
+                }
+            }
+        }
+        if !failed.is_empty() {
+            let mut pending = self.pending.lock().unwrap();
+            for (key, entry) in failed {
+                pending.insert(key, entry);
+            }
+        }
+        match first_err {
+            Some(e) => Err(e),
+            None => Ok(count),
+        }
+    }
+
+    /// Materialize all remaining entries (background warm-up / fallback).
+    pub fn materialize_all(&self) -> Result<usize> {
+        self.materialize_where(|_| true)
+    }
+
+    /// Entries still awaiting materialization.
+    pub fn pending_count(&self) -> usize {
+        self.pending.lock().unwrap().len()
+    }
+
+    /// The link farm root this instance populates.
+    pub fn target(&self) -> &Path {
+        &self.target
     }
 }
 
@@ -394,6 +637,161 @@ mod tests {
         assert!(log_path.is_dir());
     }
 
+    #[test]
+    fn test_parallel_populate_matches_eager() {
+        let temp = TempDir::new().unwrap();
+        let cas_root = temp.path().join("cas");
+        let link_farm_root = temp.path().join("lower");
+
+        let cas = CasStore::new(&cas_root).unwrap();
+
+        let base_content = b"base content";
+        let app_content = b"app content";
+        let base_hash = cas.store(base_content).unwrap();
+        let app_hash = cas.store(app_content).unwrap();
+
+        let mut base_manifest = Manifest::new();
+        base_manifest.insert(
+            "/bin/sh",
+            VnodeEntry::new_file(base_hash, base_content.len() as u64, 0, 0o755),
+        );
+        base_manifest.insert(
+            "/etc/common",
+            VnodeEntry::new_file(base_hash, base_content.len() as u64, 0, 0o644),
+        );
+        let mut app_manifest = Manifest::new();
+        app_manifest.insert(
+            "/app/main",
+            VnodeEntry::new_file(app_hash, app_content.len() as u64, 0, 0o755),
+        );
+        // Later manifest overwrites /etc/common, same semantics as populate()
+        app_manifest.insert(
+            "/etc/common",
+            VnodeEntry::new_file(app_hash, app_content.len() as u64, 0, 0o644),
+        );
+
+        let farm = LinkFarm::new(cas);
+        farm.populate_parallel(&[base_manifest, app_manifest], &link_farm_root)
+            .unwrap();
+
+        assert_eq!(
+            fs::read(link_farm_root.join("bin/sh")).unwrap(),
+            base_content
+        );
+        assert_eq!(
+            fs::read(link_farm_root.join("app/main")).unwrap(),
+            app_content
+        );
+        assert_eq!(
+            fs::read(link_farm_root.join("etc/common")).unwrap(),
+            app_content
+        );
+    }
+
+    #[test]
+    fn test_lazy_link_farm() {
+        let temp = TempDir::new().unwrap();
+        let cas_root = temp.path().join("cas");
+        let link_farm_root = temp.path().join("lower");
+
+        let cas = CasStore::new(&cas_root).unwrap();
+
+        let hot_content = b"hot file";
+        let cold_content = b"cold file";
+        let hot_hash = cas.store(hot_content).unwrap();
+        let cold_hash = cas.store(cold_content).unwrap();
+
+        let mut manifest = Manifest::new();
+        manifest.insert(
+            "/src/hot.rs",
+            VnodeEntry::new_file(hot_hash, hot_content.len() as u64, 0, 0o644),
+        );
+        manifest.insert(
+            "/assets/cold.bin",
+            VnodeEntry::new_file(cold_hash, cold_content.len() as u64, 0, 0o644),
+        );
+        manifest.insert("/var/empty", VnodeEntry::new_directory(0, 0o755));
+
+        let farm = LinkFarm::new(cas);
+        let lazy = farm.populate_lazy(&[manifest], &link_farm_root).unwrap();
+
+        // Skeleton exists, files do not
+        assert!(link_farm_root.join("src").is_dir());
+        assert!(link_farm_root.join("assets").is_dir());
+        assert!(link_farm_root.join("var/empty").is_dir());
+        assert!(!link_farm_root.join("src/hot.rs").exists());
+        assert_eq!(lazy.pending_count(), 2);
+
+        // Miss-driven materialization of a single entry
+        assert!(lazy.materialize("/src/hot.rs").unwrap());
+        assert_eq!(
+            fs::read(link_farm_root.join("src/hot.rs")).unwrap(),
+            hot_content
+        );
+        // Second call is a no-op
+        assert!(!lazy.materialize("/src/hot.rs").unwrap());
+        assert_eq!(lazy.pending_count(), 1);
+
+        // Bulk fallback picks up the rest
+        assert_eq!(lazy.materialize_all().unwrap(), 1);
+        assert_eq!(
+            fs::read(link_farm_root.join("assets/cold.bin")).unwrap(),
+            cold_content
+        );
+        assert_eq!(lazy.pending_count(), 0);
+    }
+
+    #[test]
+    fn test_lazy_link_farm_failure_keeps_entry_pending() {
+        let temp = TempDir::new().unwrap();
+        let cas_root = temp.path().join("cas");
+        let link_farm_root = temp.path().join("lower");
+
+        let cas = CasStore::new(&cas_root).unwrap();
+
+        let good_content = b"good file";
+        let good_hash = cas.store(good_content).unwrap();
+        // Referenced but never stored - linking must fail, not lose the entry
+        let missing_content = b"not ingested yet";
+        let missing_hash = CasStore::compute_hash(missing_content);
+
+        let mut manifest = Manifest::new();
+        manifest.insert(
+            "/src/good.rs",
+            VnodeEntry::new_file(good_hash, good_content.len() as u64, 0, 0o644),
+        );
+        manifest.insert(
+            "/src/missing.rs",
+            VnodeEntry::new_file(missing_hash, missing_content.len() as u64, 0, 0o644),
+        );
+
+        let farm = LinkFarm::new(cas.clone());
+        let lazy = farm.populate_lazy(&[manifest], &link_farm_root).unwrap();
+        assert_eq!(lazy.pending_count(), 2);
+
+        // Single-entry failure: error surfaces, entry stays pending
+        assert!(lazy.materialize("/src/missing.rs").is_err());
+        assert_eq!(lazy.pending_count(), 2);
+
+        // Bulk pass: the good entry links, the bad one is reported and
+        // returned to the pending set rather than silently dropped
+        assert!(lazy.materialize_all().is_err());
+        assert_eq!(
+            fs::read(link_farm_root.join("src/good.rs")).unwrap(),
+            good_content
+        );
+        assert_eq!(lazy.pending_count(), 1);
+
+        // Once the blob arrives, the retry succeeds
+        cas.store(missing_content).unwrap();
+        assert!(lazy.materialize("/src/missing.rs").unwrap());
+        assert_eq!(
+            fs::read(link_farm_root.join("src/missing.rs")).unwrap(),
+            missing_content
+        );
+        assert_eq!(lazy.pending_count(), 0);
+    }
+
     #[test]
     fn test_link_farm_merge() {
         let temp = TempDir::new().unwrap();
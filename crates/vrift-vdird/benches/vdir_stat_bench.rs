@@ -0,0 +1,156 @@
+//! Multi-threaded stat-path microbenchmarks
+//!
+//! Promotes the scenario from tests/poc/benchmark_mt_stat.c into a
+//! maintained target: N threads (1-64) hammer the seqlock-protected VDir
+//! hash table that serves every intercepted stat, each thread on its own
+//! read handle over the same mmap — the same topology as shim processes
+//! against vDird. The contended variant adds a writer that continuously
+//! updates entries through begin_write/end_write, exercising the
+//! generation-flip path a dirty build keeps hot.
+//!
+//! Machine-readable results land in target/criterion/*/estimates.json;
+//! compare releases with `cargo bench -- --save-baseline <tag>`.
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::Barrier;
+use std::time::{Duration, Instant};
+use tempfile::tempdir;
+use vrift_vdird::vdir::{fnv1a_hash, VDir, VDirEntry};
+
+const ENTRIES: usize = 10_000;
+const LOOKUPS_PER_THREAD: usize = 10_000;
+const THREAD_COUNTS: &[usize] = &[1, 2, 4, 8, 16, 32, 64];
+
+fn entry(hash: u64, size: u64) -> VDirEntry {
+    VDirEntry {
+        path_hash: hash,
+        cas_hash: [0xAB; 32],
+        size,
+        mtime_sec: 1_700_000_000,
+        mtime_nsec: 0,
+        mode: 0o644,
+        flags: 0,
+        _pad: [0; 3],
+    }
+}
+
+/// Build a populated VDir file and return its path plus the key hashes
+fn populate(dir: &std::path::Path) -> (std::path::PathBuf, Vec<u64>) {
+    let path = dir.join("bench.vdir");
+    let mut vdir = VDir::create_or_open(&path).unwrap();
+    let hashes: Vec<u64> = (0..ENTRIES)
+        .map(|i| fnv1a_hash(&format!("src/module_{i}/file_{i}.rs")))
+        .collect();
+    vdir.begin_write();
+    for &h in &hashes {
+        vdir.upsert(entry(h, 4096)).unwrap();
+    }
+    vdir.end_write();
+    (path, hashes)
+}
+
+/// One timed pass: `threads` readers, each with its own handle, measured
+/// from barrier release to the slowest thread's finish.
+fn timed_lookup_pass(path: &std::path::Path, hashes: &[u64], threads: usize) -> Duration {
+    let barrier = Barrier::new(threads + 1);
+    std::thread::scope(|s| {
+        let handles: Vec<_> = (0..threads)
+            .map(|t| {
+                let barrier = &barrier;
+                s.spawn(move || {
+                    let vdir = VDir::open_readonly(path).unwrap();
+                    barrier.wait();
+                    let start = Instant::now();
+                    let mut found = 0usize;
+                    for i in 0..LOOKUPS_PER_THREAD {
+                        let h = hashes[(i * (t + 1)) % hashes.len()];
+                        if vdir.lookup(h).is_some() {
+                            found += 1;
+                        }
+                    }
+                    assert_eq!(found, LOOKUPS_PER_THREAD);
+                    start.elapsed()
+                })
+            })
+            .collect();
+        barrier.wait();
+        handles
+            .into_iter()
+            .map(|h| h.join().unwrap())
+            .max()
+            .unwrap()
+    })
+}
+
+fn bench_mt_stat_lookup(c: &mut Criterion) {
+    let temp = tempdir().unwrap();
+    let (path, hashes) = populate(temp.path());
+
+    let mut group = c.benchmark_group("mt_stat_lookup");
+    group.sample_size(10);
+    for &threads in THREAD_COUNTS {
+        group.throughput(Throughput::Elements((threads * LOOKUPS_PER_THREAD) as u64));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(threads),
+            &threads,
+            |b, &threads| {
+                b.iter_custom(|iters| {
+                    (0..iters)
+                        .map(|_| timed_lookup_pass(&path, &hashes, threads))
+                        .sum()
+                });
+            },
+        );
+    }
+    group.finish();
+}
+
+fn bench_mt_stat_contended_writer(c: &mut Criterion) {
+    let temp = tempdir().unwrap();
+    let (path, hashes) = populate(temp.path());
+
+    let mut group = c.benchmark_group("mt_stat_contended_writer");
+    group.sample_size(10);
+    for &threads in THREAD_COUNTS {
+        group.throughput(Throughput::Elements((threads * LOOKUPS_PER_THREAD) as u64));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(threads),
+            &threads,
+            |b, &threads| {
+                b.iter_custom(|iters| {
+                    let stop = AtomicBool::new(false);
+                    std::thread::scope(|s| {
+                        // Writer: own handle on the same file, updating
+                        // existing keys only (no resize) so readers stay on
+                        // a live mapping
+                        let writer = s.spawn(|| {
+                            let mut vdir = VDir::create_or_open(&path).unwrap();
+                            let mut size = 0u64;
+                            while !stop.load(Ordering::Relaxed) {
+                                size = size.wrapping_add(1);
+                                vdir.begin_write();
+                                for &h in hashes.iter().step_by(97) {
+                                    vdir.upsert(entry(h, size)).unwrap();
+                                }
+                                vdir.end_write();
+                            }
+                        });
+
+                        let total = (0..iters)
+                            .map(|_| timed_lookup_pass(&path, &hashes, threads))
+                            .sum();
+
+                        stop.store(true, Ordering::Relaxed);
+                        writer.join().unwrap();
+                        total
+                    })
+                });
+            },
+        );
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_mt_stat_lookup, bench_mt_stat_contended_writer);
+criterion_main!(benches);
@@ -11,11 +11,31 @@ use vrift_ipc::{
     VeloError, VeloErrorKind, VeloRequest, VeloResponse, VnodeEntry, PROTOCOL_VERSION,
 };
 
+/// True if the request never mutates daemon state.
+///
+/// Read-shaped requests are served under the shared side of the handler
+/// lock, so 100 concurrent clients doing lookups never queue behind each
+/// other; only mutating requests take the exclusive path. A batch is
+/// read-only iff every sub-request is.
+pub fn is_read_only(request: &VeloRequest) -> bool {
+    match request {
+        VeloRequest::Handshake { .. }
+        | VeloRequest::Status
+        | VeloRequest::RegisterWorkspace { .. }
+        | VeloRequest::ManifestGet { .. }
+        | VeloRequest::ManifestListDir { .. } => true,
+        VeloRequest::Batch(requests) => requests.iter().all(is_read_only),
+        _ => false,
+    }
+}
+
 /// Command handler for vdir_d
 pub struct CommandHandler {
     config: ProjectConfig,
     vdir: VDir,
     manifest: std::sync::Arc<vrift_manifest::lmdb::LmdbManifest>,
+    /// GC live-set bloom, kept current as entries are ingested (RFC-0041)
+    live_set: crate::live_set::LiveSet,
 }
 
 impl CommandHandler {
@@ -24,43 +44,27 @@ impl CommandHandler {
         vdir: VDir,
         manifest: std::sync::Arc<vrift_manifest::lmdb::LmdbManifest>,
     ) -> Self {
+        let live_set = crate::live_set::LiveSet::rebuild(
+            config.project_root.join(".vrift").join("live_set.bloom"),
+            &manifest,
+        );
         Self {
             config,
             vdir,
             manifest,
+            live_set,
         }
     }
 
     /// Handle incoming request
     pub async fn handle_request(&mut self, request: VeloRequest) -> VeloResponse {
-        match request {
-            VeloRequest::Handshake {
-                client_version,
-                protocol_version,
-            } => {
-                info!(client_version = %client_version, protocol_version, "Handshake");
-                VeloResponse::HandshakeAck {
-                    server_version: env!("CARGO_PKG_VERSION").to_string(),
-                    protocol_version: PROTOCOL_VERSION,
-                    compatible: vrift_ipc::is_version_compatible(protocol_version),
-                }
-            }
-
-            VeloRequest::Status => VeloResponse::StatusAck {
-                status: "ready".to_string(),
-            },
-
-            VeloRequest::RegisterWorkspace { project_root } => {
-                info!(project_root = %project_root, "Workspace registered");
-                VeloResponse::RegisterAck {
-                    workspace_id: self.config.project_id.clone(),
-                    vdird_socket: self.config.socket_path.to_string_lossy().to_string(),
-                    vdir_mmap_path: self.config.vdir_path.to_string_lossy().to_string(),
-                }
-            }
-
-            VeloRequest::ManifestGet { path } => self.handle_manifest_get(&path),
+        // Read-shaped requests share one code path with the concurrent
+        // lock-free-read dispatch in socket.rs
+        if is_read_only(&request) {
+            return self.handle_read_request(request).await;
+        }
 
+        match request {
             VeloRequest::ManifestUpsert { path, entry } => {
                 self.handle_manifest_upsert(&path, entry)
             }
@@ -75,8 +79,6 @@ impl CommandHandler {
                 self.handle_manifest_update_mtime(&path, mtime_ns)
             }
 
-            VeloRequest::ManifestListDir { path } => self.handle_manifest_list_dir(&path),
-
             VeloRequest::ManifestReingest { vpath, temp_path } => {
                 self.handle_reingest(&vpath, &temp_path).await
             }
@@ -103,6 +105,21 @@ impl CommandHandler {
                 .await
             }
 
+            VeloRequest::Batch(requests) => {
+                // Amortize frame + wakeup cost for lookup storms (linkers, tar).
+                // Sub-requests are handled in order; responses mirror that order.
+                let mut responses = Vec::with_capacity(requests.len());
+                for sub in requests {
+                    if matches!(sub, VeloRequest::Batch(_)) {
+                        responses
+                            .push(VeloResponse::Error(VeloError::internal("Nested batch")));
+                        continue;
+                    }
+                    responses.push(Box::pin(self.handle_request(sub)).await);
+                }
+                VeloResponse::Batch(responses)
+            }
+
             // Not yet implemented - forward to future handlers
             _ => {
                 warn!(?request, "Unhandled request type");
@@ -111,6 +128,67 @@ impl CommandHandler {
         }
     }
 
+    /// Handle a read-shaped request without exclusive access
+    ///
+    /// Must cover exactly the requests `is_read_only` accepts; the socket
+    /// layer dispatches those here under the shared lock so concurrent
+    /// lookups run in parallel. VDir lookups are safe against the seqlock,
+    /// LMDB reads run in their own read transactions.
+    pub async fn handle_read_request(&self, request: VeloRequest) -> VeloResponse {
+        match request {
+            VeloRequest::Handshake {
+                client_version,
+                protocol_version,
+            } => {
+                info!(client_version = %client_version, protocol_version, "Handshake");
+                VeloResponse::HandshakeAck {
+                    server_version: env!("CARGO_PKG_VERSION").to_string(),
+                    protocol_version: PROTOCOL_VERSION,
+                    compatible: vrift_ipc::is_version_compatible(protocol_version),
+                }
+            }
+
+            VeloRequest::Status => VeloResponse::StatusAck {
+                status: "ready".to_string(),
+            },
+
+            VeloRequest::RegisterWorkspace { project_root } => {
+                info!(project_root = %project_root, "Workspace registered");
+                VeloResponse::RegisterAck {
+                    workspace_id: self.config.project_id.clone(),
+                    vdird_socket: self.config.socket_path.to_string_lossy().to_string(),
+                    vdir_mmap_path: self.config.vdir_path.to_string_lossy().to_string(),
+                }
+            }
+
+            VeloRequest::ManifestGet { path } => self.handle_manifest_get(&path),
+
+            VeloRequest::ManifestListDir { path } => self.handle_manifest_list_dir(&path),
+
+            VeloRequest::Batch(requests) => {
+                let mut responses = Vec::with_capacity(requests.len());
+                for sub in requests {
+                    if matches!(sub, VeloRequest::Batch(_)) {
+                        responses
+                            .push(VeloResponse::Error(VeloError::internal("Nested batch")));
+                        continue;
+                    }
+                    responses.push(Box::pin(self.handle_read_request(sub)).await);
+                }
+                VeloResponse::Batch(responses)
+            }
+
+            // Guard against a dispatch bug: mutating requests must never
+            // reach the shared path
+            _ => {
+                warn!(?request, "Mutating request routed to read path");
+                VeloResponse::Error(VeloError::internal(
+                    "Mutating request on read-only path",
+                ))
+            }
+        }
+    }
+
     /// Handle ManifestGet
     /// First checks VDir (runtime overlay for COW), then falls back to LMDB (persistent storage)
     fn handle_manifest_get(&self, path: &str) -> VeloResponse {
@@ -163,6 +241,7 @@ impl CommandHandler {
 
         match self.vdir.upsert(vdir_entry) {
             Ok(_) => {
+                self.live_set.add(&entry.content_hash);
                 debug!(path = %path, "Upserted entry");
                 VeloResponse::ManifestAck { entry: Some(entry) }
             }
@@ -178,6 +257,9 @@ impl CommandHandler {
         let path_hash = fnv1a_hash(path);
         if self.vdir.mark_dirty(path_hash, false) {
             // For now, just clear dirty bit. Full deletion would require tombstone.
+            // Bloom bits can't be cleared; the live set stays a safe superset
+            // until the next startup rebuild.
+            self.live_set.note_removal();
             debug!(path = %path, "Marked for removal");
             VeloResponse::ManifestAck { entry: None }
         } else {
@@ -394,6 +476,8 @@ impl CommandHandler {
             return VeloResponse::Error(VeloError::io_error(format!("VDir update error: {}", e)));
         }
 
+        self.live_set.add(&hash_bytes);
+
         info!(vpath = %vpath, hash = %hex::encode(hash_bytes), "Reingest complete");
 
         VeloResponse::ManifestAck {
@@ -1064,6 +1148,78 @@ mod tests {
         }
     }
 
+    // ==================== Read/Write Dispatch Tests ====================
+
+    #[test]
+    fn test_is_read_only_classification() {
+        assert!(is_read_only(&VeloRequest::Status));
+        assert!(is_read_only(&VeloRequest::ManifestGet {
+            path: "a".to_string()
+        }));
+        assert!(is_read_only(&VeloRequest::ManifestListDir {
+            path: "a".to_string()
+        }));
+        assert!(!is_read_only(&VeloRequest::ManifestRemove {
+            path: "a".to_string()
+        }));
+        assert!(!is_read_only(&VeloRequest::ManifestReingest {
+            vpath: "a".to_string(),
+            temp_path: "/tmp/a".to_string()
+        }));
+
+        // Batch is read-only iff every sub-request is
+        assert!(is_read_only(&VeloRequest::Batch(vec![
+            VeloRequest::Status,
+            VeloRequest::ManifestGet {
+                path: "a".to_string()
+            },
+        ])));
+        assert!(!is_read_only(&VeloRequest::Batch(vec![
+            VeloRequest::Status,
+            VeloRequest::ManifestRemove {
+                path: "a".to_string()
+            },
+        ])));
+    }
+
+    #[tokio::test]
+    async fn test_read_path_serves_get_and_rejects_mutation() {
+        let (mut handler, _temp) = create_test_handler();
+
+        handler
+            .handle_request(VeloRequest::ManifestUpsert {
+                path: "read.txt".to_string(),
+                entry: VnodeEntry {
+                    content_hash: [7; 32],
+                    size: 7,
+                    mtime: 0,
+                    mode: 0o644,
+                    flags: 0,
+                    _pad: 0,
+                },
+            })
+            .await;
+
+        // Shared path serves the lookup
+        let response = handler
+            .handle_read_request(VeloRequest::ManifestGet {
+                path: "read.txt".to_string(),
+            })
+            .await;
+        match response {
+            VeloResponse::ManifestAck { entry: Some(e) } => assert_eq!(e.size, 7),
+            _ => panic!("Expected entry via read path"),
+        }
+
+        // A mutating request must not be served there
+        let response = handler
+            .handle_read_request(VeloRequest::ManifestRemove {
+                path: "read.txt".to_string(),
+            })
+            .await;
+        assert!(matches!(response, VeloResponse::Error(_)));
+    }
+
     // ==================== Multiple Operations Tests ====================
 
     #[tokio::test]
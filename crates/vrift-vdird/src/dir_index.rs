@@ -0,0 +1,385 @@
+//! Directory-listing index builder
+//!
+//! The VDir hash table stores only path hashes, so readdir historically fell
+//! back to IPC for every directory — painful for tools like `find`, `ninja -t
+//! deps` and cargo's fingerprint scan that list huge trees constantly.
+//!
+//! This module builds the sibling `<vdir>.diridx` mmap file: a hash table
+//! keyed by directory path hash pointing into a contiguous pool of sorted
+//! child records (see `vrift_ipc::vdir_types` for the layout). The inception
+//! layer maps it read-only and serves an intercepted readdir as one
+//! contiguous scan, with no IPC and no per-entry hashing.
+//!
+//! The index is a wholesale snapshot, not incrementally maintained: it is
+//! rebuilt from the manifest at daemon startup (after VDir hydration) and
+//! refreshed by the periodic commit task. The header records the VDir
+//! generation it was built from; readers fall back to IPC whenever the live
+//! VDir generation differs, so a stale index can never serve a wrong listing.
+
+use anyhow::{Context, Result};
+use memmap2::MmapMut;
+use std::collections::BTreeMap;
+use std::fs::OpenOptions;
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicU64, Ordering};
+use tracing::{debug, info};
+
+use crate::vdir::fnv1a_hash;
+use vrift_ipc::vdir_types::*;
+
+/// Path of the dir index file next to a VDir mmap file
+pub fn diridx_path(vdir_path: &Path) -> PathBuf {
+    let mut s = vdir_path.as_os_str().to_os_string();
+    s.push(".diridx");
+    PathBuf::from(s)
+}
+
+/// Split a manifest path into (parent dir, child name).
+/// `/src/main.rs` -> (`/src`, `main.rs`); `/src` -> (`/`, `src`).
+/// Returns None for the root itself or malformed keys.
+fn split_parent(path: &str) -> Option<(&str, &str)> {
+    let idx = path.rfind('/')?;
+    let name = &path[idx + 1..];
+    if name.is_empty() {
+        return None;
+    }
+    let parent = if idx == 0 { "/" } else { &path[..idx] };
+    Some((parent, name))
+}
+
+/// Rebuild the directory index from a full manifest snapshot.
+///
+/// `vdir_generation` must be the VDir generation the manifest snapshot
+/// corresponds to (read it BEFORE iterating — if vDird writes during the
+/// build, the live generation moves past it and readers simply fall back).
+///
+/// The rebuild is seqlock-protected in place: readers see either the old
+/// index or the new one. The file never shrinks, so a reader holding a
+/// mapping of an older (larger) size can never fault. Returns the number of
+/// directories indexed.
+pub fn rebuild_dir_index(
+    path: &Path,
+    manifest: &vrift_manifest::lmdb::LmdbManifest,
+    vdir_generation: u64,
+) -> Result<usize> {
+    let entries = manifest
+        .iter()
+        .map_err(|e| anyhow::anyhow!("manifest iteration failed: {}", e))?;
+
+    // Group children by parent directory. Walking the full parent chain
+    // (not just the direct parent) makes listings complete even when an
+    // intermediate directory has no explicit manifest entry.
+    let mut dirs: BTreeMap<&str, BTreeMap<&str, u8>> = BTreeMap::new();
+    for (entry_path, manifest_entry) in &entries {
+        let vnode = &manifest_entry.vnode;
+        let d_type = if vnode.is_dir() {
+            DIRIDX_DT_DIR
+        } else if vnode.flags & 2 != 0 {
+            DIRIDX_DT_LNK
+        } else {
+            DIRIDX_DT_REG
+        };
+
+        let mut current = entry_path.as_str();
+        let mut current_type = d_type;
+        while let Some((parent, name)) = split_parent(current) {
+            dirs.entry(parent).or_default().insert(name, current_type);
+            // Everything above the direct parent is by definition a directory
+            current = parent;
+            current_type = DIRIDX_DT_DIR;
+            if parent == "/" {
+                break;
+            }
+        }
+    }
+
+    let dir_count = dirs.len();
+
+    // Size the slot table at <= 75% load, same policy as the VDir table
+    let mut table_capacity: usize = 1024;
+    while dir_count as f64 / table_capacity as f64 > 0.75 {
+        table_capacity *= 2;
+    }
+
+    // Lay out the children pool: per-dir contiguous, names sorted (BTreeMap
+    // iteration order), each record 4-byte aligned.
+    let mut pool: Vec<u8> = Vec::new();
+    let mut slots: Vec<DirIndexSlot> = vec![DirIndexSlot::default(); table_capacity];
+    for (dir, children) in &dirs {
+        let children_offset = pool.len() as u32;
+        let mut children_count = 0u32;
+        for (name, d_type) in children {
+            let record_start = pool.len();
+            let record_len = diridx_child_record_len(name.len());
+            pool.extend_from_slice(&(name.len() as u16).to_le_bytes());
+            pool.push(*d_type);
+            pool.push(0);
+            pool.extend_from_slice(name.as_bytes());
+            // Pad record to 4-byte alignment
+            pool.resize(record_start + record_len, 0);
+            children_count += 1;
+        }
+        let children_bytes = pool.len() as u32 - children_offset;
+
+        let dir_hash = fnv1a_hash(dir);
+        let start = (dir_hash as usize) % table_capacity;
+        for i in 0..table_capacity {
+            let slot = (start + i) % table_capacity;
+            if slots[slot].is_empty() {
+                slots[slot] = DirIndexSlot {
+                    dir_hash,
+                    children_offset,
+                    children_bytes,
+                    children_count,
+                    _pad: 0,
+                };
+                break;
+            }
+        }
+    }
+
+    let table_offset = DIRIDX_HEADER_SIZE;
+    let pool_offset = table_offset + table_capacity * DIRIDX_SLOT_SIZE;
+    let needed_size = pool_offset + pool.len();
+
+    let file = OpenOptions::new()
+        .read(true)
+        .write(true)
+        .create(true)
+        .truncate(false)
+        .open(path)
+        .context("Failed to open dir index file")?;
+
+    // Grow only — shrinking could SIGBUS a reader holding an older mapping
+    let current_len = file.metadata()?.len() as usize;
+    if current_len < needed_size {
+        file.set_len(needed_size as u64)?;
+    }
+
+    let mut mmap = unsafe { MmapMut::map_mut(&file)? };
+
+    // Seqlock write: odd generation while the snapshot is being replaced
+    let old_generation = {
+        let header = unsafe { &*(mmap.as_ptr() as *const DirIndexHeader) };
+        if header.magic == DIRIDX_MAGIC && header.generation & 1 == 0 {
+            header.generation
+        } else {
+            0
+        }
+    };
+    let gen_atomic = unsafe { &*((mmap.as_ptr() as usize + 8) as *const AtomicU64) };
+    gen_atomic.store(old_generation + 1, Ordering::Release);
+
+    // Body: slot table + children pool
+    unsafe {
+        let table_ptr = mmap.as_mut_ptr().add(table_offset);
+        std::ptr::copy_nonoverlapping(
+            slots.as_ptr() as *const u8,
+            table_ptr,
+            table_capacity * DIRIDX_SLOT_SIZE,
+        );
+        let pool_ptr = mmap.as_mut_ptr().add(pool_offset);
+        std::ptr::copy_nonoverlapping(pool.as_ptr(), pool_ptr, pool.len());
+    }
+
+    // Header fields (generation published last, below)
+    {
+        let header = unsafe { &mut *(mmap.as_mut_ptr() as *mut DirIndexHeader) };
+        header.magic = DIRIDX_MAGIC;
+        header.version = DIRIDX_VERSION;
+        header.vdir_generation = vdir_generation;
+        header.dir_count = dir_count as u32;
+        header.table_capacity = table_capacity as u32;
+        header.table_offset = table_offset as u32;
+        header.pool_offset = pool_offset as u32;
+        header.pool_size = pool.len() as u32;
+        header.crc32 = compute_header_crc(header);
+    }
+
+    gen_atomic.store(old_generation + 2, Ordering::Release);
+    mmap.flush()?;
+
+    debug!(
+        dirs = dir_count,
+        pool_bytes = pool.len(),
+        vdir_generation,
+        "Dir index rebuilt"
+    );
+    Ok(dir_count)
+}
+
+/// CRC32 of header fields before the crc32 field (first 44 bytes)
+fn compute_header_crc(header: &DirIndexHeader) -> u32 {
+    let bytes =
+        unsafe { std::slice::from_raw_parts(header as *const DirIndexHeader as *const u8, 44) };
+    crc32fast::hash(bytes)
+}
+
+/// Rebuild the index only if the VDir generation moved since the last build.
+/// Used by the periodic commit task; returns Some(dir_count) when rebuilt.
+pub fn rebuild_if_stale(
+    diridx_path: &Path,
+    vdir_path: &Path,
+    manifest: &vrift_manifest::lmdb::LmdbManifest,
+    last_built_generation: &mut u64,
+) -> Result<Option<usize>> {
+    let vdir = crate::vdir::VDir::open_readonly(vdir_path)?;
+    let generation = vdir.generation();
+    if generation & 1 != 0 || generation == *last_built_generation {
+        return Ok(None);
+    }
+    let count = rebuild_dir_index(diridx_path, manifest, generation)?;
+    *last_built_generation = generation;
+    info!(dirs = count, generation, "Dir index refreshed");
+    Ok(Some(count))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use tempfile::tempdir;
+    use vrift_manifest::lmdb::{AssetTier, LmdbManifest};
+    use vrift_manifest::VnodeEntry;
+
+    /// Test-side reader: parse children of a directory straight from the file
+    fn read_children(path: &Path, dir: &str) -> Option<Vec<(String, u8)>> {
+        let data = std::fs::read(path).ok()?;
+        let header = unsafe { &*(data.as_ptr() as *const DirIndexHeader) };
+        assert_eq!(header.magic, DIRIDX_MAGIC);
+        assert_eq!(header.generation & 1, 0, "generation must be even");
+
+        let capacity = header.table_capacity as usize;
+        let dir_hash = fnv1a_hash(dir);
+        let start = (dir_hash as usize) % capacity;
+        for i in 0..capacity {
+            let slot_idx = (start + i) % capacity;
+            let offset = header.table_offset as usize + slot_idx * DIRIDX_SLOT_SIZE;
+            let slot = unsafe { &*(data.as_ptr().add(offset) as *const DirIndexSlot) };
+            if slot.is_empty() {
+                return None;
+            }
+            if slot.dir_hash != dir_hash {
+                continue;
+            }
+
+            let mut children = Vec::new();
+            let base = header.pool_offset as usize + slot.children_offset as usize;
+            let mut cursor = 0usize;
+            for _ in 0..slot.children_count {
+                let child =
+                    unsafe { &*(data.as_ptr().add(base + cursor) as *const DirIndexChild) };
+                let name_start = base + cursor + DIRIDX_CHILD_HEADER_SIZE;
+                let name = std::str::from_utf8(
+                    &data[name_start..name_start + child.name_len as usize],
+                )
+                .unwrap()
+                .to_string();
+                children.push((name, child.d_type));
+                cursor += diridx_child_record_len(child.name_len as usize);
+            }
+            assert_eq!(cursor, slot.children_bytes as usize);
+            return Some(children);
+        }
+        None
+    }
+
+    fn seed_manifest(manifest: &LmdbManifest) {
+        manifest.insert(
+            "/src",
+            VnodeEntry::new_directory(1706448000, 0o755),
+            AssetTier::Tier2Mutable,
+        );
+        manifest.insert(
+            "/src/main.rs",
+            VnodeEntry::new_file([0xAA; 32], 4096, 1706448000, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        manifest.insert(
+            "/src/lib.rs",
+            VnodeEntry::new_file([0xBB; 32], 128, 1706448001, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        // Intermediate dir "/src/nested" has NO explicit manifest entry
+        manifest.insert(
+            "/src/nested/mod.rs",
+            VnodeEntry::new_file([0xCC; 32], 64, 1706448002, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+    }
+
+    #[test]
+    fn test_rebuild_and_lookup() {
+        let temp = tempdir().unwrap();
+        let idx_path = temp.path().join("test.vdir.diridx");
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+        seed_manifest(&manifest);
+
+        let dirs = rebuild_dir_index(&idx_path, &manifest, 42).unwrap();
+        // "/", "/src", "/src/nested"
+        assert_eq!(dirs, 3);
+
+        // Children sorted by name; implied dir appears with DT_DIR
+        let src = read_children(&idx_path, "/src").unwrap();
+        assert_eq!(
+            src,
+            vec![
+                ("lib.rs".to_string(), DIRIDX_DT_REG),
+                ("main.rs".to_string(), DIRIDX_DT_REG),
+                ("nested".to_string(), DIRIDX_DT_DIR),
+            ]
+        );
+
+        let root = read_children(&idx_path, "/").unwrap();
+        assert_eq!(root, vec![("src".to_string(), DIRIDX_DT_DIR)]);
+
+        let nested = read_children(&idx_path, "/src/nested").unwrap();
+        assert_eq!(nested, vec![("mod.rs".to_string(), DIRIDX_DT_REG)]);
+
+        // Unknown directory is a clean miss
+        assert!(read_children(&idx_path, "/does/not/exist").is_none());
+
+        // Header records the VDir generation it was built from
+        let data = std::fs::read(&idx_path).unwrap();
+        let header = unsafe { &*(data.as_ptr() as *const DirIndexHeader) };
+        assert_eq!(header.vdir_generation, 42);
+    }
+
+    #[test]
+    fn test_rebuild_in_place_never_shrinks() {
+        let temp = tempdir().unwrap();
+        let idx_path = temp.path().join("test.vdir.diridx");
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+        seed_manifest(&manifest);
+
+        rebuild_dir_index(&idx_path, &manifest, 2).unwrap();
+        let size_before = std::fs::metadata(&idx_path).unwrap().len();
+
+        // Second rebuild from the same manifest: same content, file keeps size
+        rebuild_dir_index(&idx_path, &manifest, 4).unwrap();
+        let size_after = std::fs::metadata(&idx_path).unwrap().len();
+        assert_eq!(size_before, size_after);
+
+        // Generation advanced by one full write cycle and stayed even
+        let data = std::fs::read(&idx_path).unwrap();
+        let header = unsafe { &*(data.as_ptr() as *const DirIndexHeader) };
+        assert_eq!(header.generation, 4);
+        assert_eq!(header.vdir_generation, 4);
+    }
+
+    #[test]
+    fn test_empty_manifest_builds_empty_index() {
+        let temp = tempdir().unwrap();
+        let idx_path = temp.path().join("empty.vdir.diridx");
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+
+        let dirs = rebuild_dir_index(&idx_path, &manifest, 0).unwrap();
+        assert_eq!(dirs, 0);
+        assert!(read_children(&idx_path, "/").is_none());
+    }
+
+    #[test]
+    fn test_diridx_path_derivation() {
+        let p = diridx_path(Path::new("/dev/shm/vrift_vdir_abc"));
+        assert_eq!(p, PathBuf::from("/dev/shm/vrift_vdir_abc.diridx"));
+    }
+}
@@ -7,7 +7,7 @@ use std::collections::HashMap;
 use std::fs::{self, File};
 use std::io::{self, BufReader, BufWriter};
 use std::path::{Path, PathBuf};
-use std::time::{SystemTime, UNIX_EPOCH};
+use std::time::{Duration, Instant, SystemTime, UNIX_EPOCH};
 
 use rkyv::Archive;
 use serde::{Deserialize, Serialize};
@@ -27,12 +27,31 @@ pub struct JournalEntry {
     pub started_at: u64,
 }
 
+/// Mutations buffered since the last durable sync before group commit
+/// forces one regardless of the interval.
+const GROUP_COMMIT_MAX_OPS: usize = 256;
+
+/// Maximum time buffered mutations may stay volatile. This is the crash
+/// durability window; recovery is idempotent, so losing it only means
+/// re-ingesting the affected files.
+const GROUP_COMMIT_INTERVAL: Duration = Duration::from_millis(50);
+
 /// Reingest journal for crash recovery
+///
+/// Mutations are acknowledged from the in-memory buffer and persisted by
+/// group commit: one fdatasync per `GROUP_COMMIT_INTERVAL` or per
+/// `GROUP_COMMIT_MAX_OPS` buffered operations, whichever comes first,
+/// instead of one per `record()`. Compiler-driven write storms no longer
+/// serialize on the journal's fsync.
 pub struct ReingestJournal {
     /// Path to journal file
     path: PathBuf,
     /// In-memory entries
     entries: HashMap<String, JournalEntry>,
+    /// Mutations buffered since the last durable sync
+    buffered_ops: usize,
+    /// When the last durable sync completed
+    last_sync: Instant,
 }
 
 impl ReingestJournal {
@@ -66,6 +85,8 @@ impl ReingestJournal {
         Ok(Self {
             path: path.to_path_buf(),
             entries,
+            buffered_ops: 0,
+            last_sync: Instant::now(),
         })
     }
 
@@ -82,7 +103,7 @@ impl ReingestJournal {
         };
 
         self.entries.insert(vpath.to_string(), entry);
-        self.flush()?;
+        self.commit()?;
 
         debug!(vpath, temp_path, "Recorded reingest intent");
         Ok(())
@@ -92,7 +113,7 @@ impl ReingestJournal {
     pub fn set_cas_hash(&mut self, vpath: &str, hash: [u8; 32]) -> io::Result<()> {
         if let Some(entry) = self.entries.get_mut(vpath) {
             entry.cas_hash = Some(hash);
-            self.flush()?;
+            self.commit()?;
             debug!(vpath, "Updated journal with CAS hash");
         }
         Ok(())
@@ -101,7 +122,7 @@ impl ReingestJournal {
     /// Mark reingest as complete and remove from journal
     pub fn complete(&mut self, vpath: &str) -> io::Result<()> {
         if self.entries.remove(vpath).is_some() {
-            self.flush()?;
+            self.commit()?;
             debug!(vpath, "Removed completed reingest from journal");
         }
         Ok(())
@@ -144,6 +165,7 @@ impl ReingestJournal {
         }
 
         if count > 0 {
+            // Runs at startup, not on the write path — sync immediately
             self.flush()?;
             info!(count, "Cleaned stale journal entries");
         }
@@ -151,8 +173,28 @@ impl ReingestJournal {
         Ok(count)
     }
 
-    /// Flush journal to disk
-    fn flush(&self) -> io::Result<()> {
+    /// Group-commit a mutation: acknowledge from the in-memory buffer and
+    /// only hit disk when the op count or interval threshold is reached.
+    fn commit(&mut self) -> io::Result<()> {
+        self.buffered_ops += 1;
+        if self.buffered_ops >= GROUP_COMMIT_MAX_OPS
+            || self.last_sync.elapsed() >= GROUP_COMMIT_INTERVAL
+        {
+            self.flush()?;
+        }
+        Ok(())
+    }
+
+    /// Force buffered mutations to durable storage now
+    pub fn sync(&mut self) -> io::Result<()> {
+        if self.buffered_ops > 0 {
+            self.flush()?;
+        }
+        Ok(())
+    }
+
+    /// Flush journal to disk (fdatasync'd, atomic rename)
+    fn flush(&mut self) -> io::Result<()> {
         // Ensure parent directory exists
         if let Some(parent) = self.path.parent() {
             fs::create_dir_all(parent)?;
@@ -166,7 +208,15 @@ impl ReingestJournal {
             .map_err(|e| io::Error::new(io::ErrorKind::InvalidData, e.to_string()))?;
         std::io::Write::write_all(&mut writer, &data)?;
 
+        // One fdatasync covers every mutation buffered since the last flush
+        let file = writer
+            .into_inner()
+            .map_err(|e| io::Error::other(e.to_string()))?;
+        file.sync_data()?;
+
         fs::rename(&temp_path, &self.path)?;
+        self.buffered_ops = 0;
+        self.last_sync = Instant::now();
         Ok(())
     }
 
@@ -181,6 +231,17 @@ impl ReingestJournal {
     }
 }
 
+impl Drop for ReingestJournal {
+    /// Close the durability window on clean shutdown
+    fn drop(&mut self) {
+        if self.buffered_ops > 0 {
+            if let Err(e) = self.flush() {
+                warn!(error = %e, "Failed to flush journal on drop");
+            }
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -258,4 +319,37 @@ mod tests {
         assert_eq!(journal.len(), 1);
         assert!(journal.entries.contains_key("new.txt"));
     }
+
+    #[test]
+    fn test_journal_group_commit() {
+        let dir = tempdir().unwrap();
+        let path = dir.path().join("journal.bin");
+
+        let mut journal = ReingestJournal::open(&path).unwrap();
+        // Push the last sync into the future so the interval can't fire
+        journal.last_sync = Instant::now() + Duration::from_secs(3600);
+
+        // Mutations below both thresholds stay buffered — nothing on disk
+        journal.record("a.rs", "/tmp/a.tmp").unwrap();
+        journal.record("b.rs", "/tmp/b.tmp").unwrap();
+        assert!(!path.exists());
+        assert_eq!(journal.len(), 2); // acknowledged from the buffer
+
+        // Explicit sync makes them durable
+        journal.sync().unwrap();
+        assert!(path.exists());
+        assert_eq!(journal.buffered_ops, 0);
+
+        // The op-count threshold forces a sync without an explicit call
+        journal.last_sync = Instant::now() + Duration::from_secs(3600);
+        for i in 0..GROUP_COMMIT_MAX_OPS {
+            journal.record(&format!("f{i}.rs"), "/tmp/f.tmp").unwrap();
+        }
+        assert_eq!(journal.buffered_ops, 0);
+
+        // Reopen sees everything that was synced
+        drop(journal);
+        let journal = ReingestJournal::open(&path).unwrap();
+        assert_eq!(journal.len(), 2 + GROUP_COMMIT_MAX_OPS);
+    }
 }
@@ -16,9 +16,12 @@
 //! - Protocol: rkyv-serialized VeloRequest/VeloResponse
 
 pub mod commands;
+pub mod dir_index;
 pub mod ignore;
 pub mod ingest;
 pub mod journal;
+pub mod live_set;
+pub mod ring;
 pub mod scan;
 pub mod socket;
 pub mod state;
@@ -121,7 +124,7 @@ pub async fn run_daemon(config: ProjectConfig) -> Result<()> {
     }
 
     // Initialize VDir mmap
-    let vdir = vdir::VDir::create_or_open(&config.vdir_path)?;
+    let mut vdir = vdir::VDir::create_or_open(&config.vdir_path)?;
     info!(path = %config.vdir_path.display(), "VDir mmap initialized");
 
     // Initialize reingest journal for crash recovery
@@ -163,6 +166,27 @@ pub async fn run_daemon(config: ProjectConfig) -> Result<()> {
     );
     info!(path = %manifest_path.display(), "LMDB manifest initialized");
 
+    // RFC-0044: Publish a full manifest snapshot into the VDir mmap BEFORE
+    // accepting clients. The inception layer's stat hot path probes this
+    // table with zero syscalls; hydrating up front means a clean build's
+    // stat storm never falls back to socket IPC.
+    match vdir.hydrate_from_manifest(&manifest) {
+        Ok(count) => info!(count, "VDir hydrated from manifest snapshot"),
+        Err(e) => tracing::warn!(error = %e, "VDir hydration failed, continuing with empty table"),
+    }
+
+    // Build the sibling directory-listing index so intercepted readdir is
+    // served from shared memory too (see dir_index module docs).
+    let diridx_path = dir_index::diridx_path(&config.vdir_path);
+    let mut diridx_generation = vdir.generation();
+    match dir_index::rebuild_dir_index(&diridx_path, &manifest, diridx_generation) {
+        Ok(dirs) => info!(dirs, "Dir index built from manifest snapshot"),
+        Err(e) => {
+            tracing::warn!(error = %e, "Dir index build failed, readdir will use IPC");
+            diridx_generation = 0;
+        }
+    }
+
     // P0: Load persistent state (last_scan time)
     let state_path = state::state_path(&config.project_root);
     let mut daemon_state = state::DaemonState::load(&state_path);
@@ -217,8 +241,10 @@ pub async fn run_daemon(config: ProjectConfig) -> Result<()> {
     // P1: Periodic manifest commit task (every 30 seconds)
     let commit_manifest = manifest.clone();
     let commit_state_path = state_path.clone();
+    let commit_vdir_path = config.vdir_path.clone();
     let commit_handle = tokio::spawn(async move {
         let mut interval = tokio::time::interval(std::time::Duration::from_secs(30));
+        let mut last_diridx_generation = diridx_generation;
         loop {
             interval.tick().await;
 
@@ -234,6 +260,17 @@ pub async fn run_daemon(config: ProjectConfig) -> Result<()> {
                         tracing::warn!(error = %e, "Failed to save state after commit");
                     }
                     tracing::debug!("Periodic manifest commit completed");
+
+                    // Refresh the dir index when the VDir moved since the
+                    // last build (ingests bumped the generation)
+                    if let Err(e) = dir_index::rebuild_if_stale(
+                        &diridx_path,
+                        &commit_vdir_path,
+                        &commit_manifest,
+                        &mut last_diridx_generation,
+                    ) {
+                        tracing::warn!(error = %e, "Dir index refresh failed");
+                    }
                 }
                 Err(e) => {
                     tracing::warn!(error = %e, "Periodic manifest commit failed");
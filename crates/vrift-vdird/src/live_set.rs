@@ -0,0 +1,185 @@
+//! Incremental live-set bloom maintenance (RFC-0041 GC mark phase)
+//!
+//! Historically `vrift gc` rebuilt the live-set bloom by walking every
+//! manifest at sweep time, which turned GC into a maintenance window.
+//! vDird already sees every ingest and remove, so it keeps the bloom
+//! up to date continuously and persists it next to the project at
+//! `.vrift/live_set.bloom`; `vrift gc` then ORs the per-project blooms
+//! and can sweep anytime.
+//!
+//! Bloom bits cannot be cleared, so removals only accumulate stale bits
+//! (a superset live set — safe: sweep keeps at worst a few dead blobs
+//! until the next rebuild). The set is rebuilt from the LMDB manifest at
+//! every daemon startup, which bounds the staleness.
+
+use std::io::Write;
+use std::path::{Path, PathBuf};
+
+use anyhow::{Context, Result};
+use tracing::{debug, info, warn};
+use vrift_ipc::{BloomFilter, BLOOM_SIZE};
+
+/// "VRBL" — live-set bloom file magic
+const LIVE_SET_MAGIC: [u8; 4] = *b"VRBL";
+const LIVE_SET_VERSION: u32 = 1;
+
+/// Persist after this many unsaved adds (ingest bursts amortize the write)
+const FLUSH_EVERY_ADDS: u32 = 256;
+
+/// Continuously maintained live-set bloom for one project
+pub struct LiveSet {
+    bloom: BloomFilter,
+    path: PathBuf,
+    pending_adds: u32,
+    /// Removals since the last rebuild — their bits stay set until the
+    /// next daemon start, they are only tracked for observability
+    removals: u64,
+}
+
+impl LiveSet {
+    /// Rebuild the bloom from the manifest (daemon startup). This is the
+    /// only point where stale bits from removals are shed.
+    pub fn rebuild(path: PathBuf, manifest: &vrift_manifest::lmdb::LmdbManifest) -> Self {
+        let mut bloom = BloomFilter::new(BLOOM_SIZE);
+        let mut count = 0u64;
+        match manifest.iter() {
+            Ok(entries) => {
+                for (_, entry) in entries {
+                    bloom.add(&hex::encode(entry.vnode.content_hash));
+                    count += 1;
+                }
+            }
+            Err(e) => warn!(error = %e, "Live-set rebuild: manifest iteration failed"),
+        }
+
+        let live_set = Self {
+            bloom,
+            path,
+            pending_adds: 0,
+            removals: 0,
+        };
+        if let Err(e) = live_set.save() {
+            warn!(error = %e, "Failed to persist live-set bloom");
+        }
+        info!(entries = count, path = %live_set.path.display(), "Live-set bloom rebuilt");
+        live_set
+    }
+
+    /// Record a newly referenced blob (upsert / reingest / full scan)
+    pub fn add(&mut self, content_hash: &[u8; 32]) {
+        self.bloom.add(&hex::encode(content_hash));
+        self.pending_adds += 1;
+        if self.pending_adds >= FLUSH_EVERY_ADDS {
+            if let Err(e) = self.save() {
+                warn!(error = %e, "Failed to persist live-set bloom");
+            }
+            self.pending_adds = 0;
+        }
+    }
+
+    /// Record a dereference. Bits stay set (bloom), but the counter shows
+    /// how stale the set has grown since the last rebuild.
+    pub fn note_removal(&mut self) {
+        self.removals += 1;
+    }
+
+    /// Flush pending adds to disk (shutdown / post-ingest)
+    pub fn flush(&mut self) {
+        if self.pending_adds > 0 {
+            if let Err(e) = self.save() {
+                warn!(error = %e, "Failed to persist live-set bloom");
+            }
+            self.pending_adds = 0;
+        }
+    }
+
+    /// Atomic persist: temp write + rename, same pattern as the journal
+    fn save(&self) -> Result<()> {
+        if let Some(parent) = self.path.parent() {
+            std::fs::create_dir_all(parent)?;
+        }
+        let temp = self.path.with_extension("bloom.tmp");
+        {
+            let mut f = std::fs::File::create(&temp)
+                .with_context(|| format!("Failed to create {}", temp.display()))?;
+            f.write_all(&LIVE_SET_MAGIC)?;
+            f.write_all(&LIVE_SET_VERSION.to_le_bytes())?;
+            f.write_all(&(self.bloom.bits.len() as u64).to_le_bytes())?;
+            f.write_all(&self.bloom.bits)?;
+        }
+        std::fs::rename(&temp, &self.path)?;
+        debug!(removals = self.removals, "Live-set bloom persisted");
+        Ok(())
+    }
+}
+
+/// Load a persisted live-set bloom (reader side: `vrift gc`).
+/// Returns None for missing, truncated, or version-mismatched files —
+/// callers fall back to the manifest walk.
+pub fn load(path: &Path) -> Option<BloomFilter> {
+    let data = std::fs::read(path).ok()?;
+    if data.len() < 16 || data[..4] != LIVE_SET_MAGIC {
+        return None;
+    }
+    let version = u32::from_le_bytes(data[4..8].try_into().ok()?);
+    if version != LIVE_SET_VERSION {
+        return None;
+    }
+    let len = u64::from_le_bytes(data[8..16].try_into().ok()?) as usize;
+    if data.len() != 16 + len {
+        return None;
+    }
+    Some(BloomFilter {
+        bits: data[16..].to_vec(),
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use tempfile::tempdir;
+    use vrift_manifest::lmdb::{AssetTier, LmdbManifest};
+    use vrift_manifest::VnodeEntry;
+
+    fn vnode(hash: [u8; 32]) -> VnodeEntry {
+        VnodeEntry {
+            content_hash: hash,
+            size: 1,
+            mtime: 0,
+            mode: 0o644,
+            flags: 0,
+            _pad: 0,
+        }
+    }
+
+    #[test]
+    fn test_live_set_rebuild_add_and_load() {
+        let temp = tempdir().unwrap();
+        let manifest = LmdbManifest::open(temp.path().join("m.lmdb")).unwrap();
+        manifest.insert("a.rs", vnode([1; 32]), AssetTier::Tier2Mutable);
+        manifest.insert("b.rs", vnode([2; 32]), AssetTier::Tier2Mutable);
+
+        let bloom_path = temp.path().join("live_set.bloom");
+        let mut live_set = LiveSet::rebuild(bloom_path.clone(), &manifest);
+
+        let loaded = load(&bloom_path).expect("persisted bloom loads");
+        assert!(loaded.contains(&hex::encode([1u8; 32])));
+        assert!(loaded.contains(&hex::encode([2u8; 32])));
+        assert!(!loaded.contains(&hex::encode([9u8; 32])));
+
+        // Incremental add is visible after flush
+        live_set.add(&[3; 32]);
+        live_set.flush();
+        let loaded = load(&bloom_path).unwrap();
+        assert!(loaded.contains(&hex::encode([3u8; 32])));
+    }
+
+    #[test]
+    fn test_load_rejects_garbage() {
+        let temp = tempdir().unwrap();
+        let path = temp.path().join("junk.bloom");
+        std::fs::write(&path, b"not a bloom").unwrap();
+        assert!(load(&path).is_none());
+        assert!(load(&temp.path().join("missing.bloom")).is_none());
+    }
+}
@@ -0,0 +1,253 @@
+//! Shared-memory ring service for stat-shaped lookups
+//!
+//! Serves the transport defined in `vrift_ipc::shm_ring`. A client sends
+//! `VeloRequest::RingSetup` over the socket; we create a per-client ring
+//! file, spawn a blocking poller that answers ManifestGet requests in
+//! place, and return the file path in `RingSetupAck`. In the steady state
+//! a lookup costs the client a few atomics and costs us one pass over the
+//! slots — no socket syscalls on either side.
+//!
+//! The poller opens its own VDir handle on the shared mmap (multi-reader
+//! safe via the seqlock, same as the inception layer's direct mapping)
+//! and shares the LMDB manifest, so it never contends with the socket
+//! path's handler lock.
+
+use std::path::PathBuf;
+use std::sync::atomic::{AtomicU32, Ordering};
+use std::sync::Arc;
+
+use memmap2::MmapMut;
+use tracing::{info, warn};
+use vrift_ipc::shm_ring::{
+    RingVnode, ShmRing, RING_DEFAULT_SLOTS, RING_OP_MANIFEST_GET, RING_STATUS_ERROR,
+    RING_STATUS_FOUND, RING_STATUS_NOT_FOUND,
+};
+use vrift_ipc::{VeloError, VeloResponse};
+
+use crate::vdir::{fnv1a_hash, VDir};
+use crate::ProjectConfig;
+
+/// How long the poller sleeps on the doorbell futex before re-checking
+/// for shutdown
+const POLL_TIMEOUT_MS: u32 = 100;
+
+/// Creates rings on request and owns the per-ring poller tasks
+pub struct RingService {
+    config: ProjectConfig,
+    manifest: Arc<vrift_manifest::lmdb::LmdbManifest>,
+    ring_dir: PathBuf,
+    next_id: AtomicU32,
+}
+
+impl RingService {
+    pub fn new(
+        config: ProjectConfig,
+        manifest: Arc<vrift_manifest::lmdb::LmdbManifest>,
+    ) -> Self {
+        let ring_dir = config.project_root.join(".vrift").join("rings");
+        // Stale rings from a previous daemon instance are dead weight —
+        // clients re-negotiate on reconnect
+        if ring_dir.exists() {
+            let _ = std::fs::remove_dir_all(&ring_dir);
+        }
+        Self {
+            config,
+            manifest,
+            ring_dir,
+            next_id: AtomicU32::new(0),
+        }
+    }
+
+    /// Handle `VeloRequest::RingSetup`: create a ring file, spawn its
+    /// poller, and tell the client where to map it
+    pub fn setup(&self) -> VeloResponse {
+        let slots = RING_DEFAULT_SLOTS;
+        let id = self.next_id.fetch_add(1, Ordering::Relaxed);
+        let shm_path = self.ring_dir.join(format!("ring_{id}.shm"));
+
+        let mut mmap = match self.create_ring_file(&shm_path, slots) {
+            Ok(m) => m,
+            Err(e) => {
+                warn!(error = %e, "Ring setup failed");
+                return VeloResponse::Error(VeloError::io_error(format!(
+                    "Ring setup failed: {}",
+                    e
+                )));
+            }
+        };
+
+        // Initialize the header before acking so the client never attaches
+        // to an unformatted ring
+        unsafe { ShmRing::init_in_place(mmap.as_mut_ptr(), slots) };
+
+        // Detached OS thread rather than spawn_blocking: the poller runs for
+        // the daemon's lifetime, and the tokio runtime must not wait for it
+        // on shutdown
+        let vdir_path = self.config.vdir_path.clone();
+        let manifest = Arc::clone(&self.manifest);
+        std::thread::Builder::new()
+            .name(format!("ring-poller-{id}"))
+            .spawn(move || run_poller(mmap, slots, vdir_path, manifest))
+            .ok();
+
+        info!(path = %shm_path.display(), slots, "Ring created");
+        VeloResponse::RingSetupAck {
+            shm_path: shm_path.to_string_lossy().to_string(),
+            slots,
+        }
+    }
+
+    fn create_ring_file(&self, path: &PathBuf, slots: u32) -> std::io::Result<MmapMut> {
+        std::fs::create_dir_all(&self.ring_dir)?;
+        let file = std::fs::OpenOptions::new()
+            .read(true)
+            .write(true)
+            .create(true)
+            .truncate(true)
+            .open(path)?;
+        file.set_len(ShmRing::required_size(slots) as u64)?;
+        unsafe { MmapMut::map_mut(&file) }
+    }
+}
+
+/// Blocking poller: wait on the doorbell, then batch-answer every pending
+/// slot. Runs for the daemon's lifetime (ring files are recreated per
+/// daemon instance, so an abandoned ring just idles on its futex).
+fn run_poller(
+    mmap: MmapMut,
+    slots: u32,
+    vdir_path: PathBuf,
+    manifest: Arc<vrift_manifest::lmdb::LmdbManifest>,
+) {
+    let ring = match unsafe { ShmRing::from_raw(mmap.as_ptr(), ShmRing::required_size(slots)) } {
+        Some(r) => r,
+        None => {
+            warn!("Ring poller: invalid ring mapping, exiting");
+            return;
+        }
+    };
+
+    // Own read handle on the shared VDir mmap; the seqlock makes
+    // concurrent readers safe against the socket path's writer
+    let vdir = match VDir::create_or_open(&vdir_path) {
+        Ok(v) => v,
+        Err(e) => {
+            warn!(error = %e, "Ring poller failed to open VDir, exiting");
+            return;
+        }
+    };
+
+    loop {
+        ring.wait_for_requests(POLL_TIMEOUT_MS);
+        ring.drain_requests(|op, path_bytes| {
+            if op != RING_OP_MANIFEST_GET {
+                return (RING_STATUS_ERROR, RingVnode::default());
+            }
+            let path = match std::str::from_utf8(path_bytes) {
+                Ok(p) => p,
+                Err(_) => return (RING_STATUS_ERROR, RingVnode::default()),
+            };
+            serve_manifest_get(&vdir, &manifest, path)
+        });
+    }
+}
+
+/// Same lookup order as `CommandHandler::handle_manifest_get`: VDir
+/// overlay first, then LMDB
+fn serve_manifest_get(
+    vdir: &VDir,
+    manifest: &vrift_manifest::lmdb::LmdbManifest,
+    path: &str,
+) -> (u32, RingVnode) {
+    if let Some(entry) = vdir.lookup(fnv1a_hash(path)) {
+        return (
+            RING_STATUS_FOUND,
+            RingVnode {
+                content_hash: entry.cas_hash,
+                size: entry.size,
+                mtime: entry.mtime_sec as u64,
+                mode: entry.mode,
+                flags: entry.flags,
+                _pad: 0,
+            },
+        );
+    }
+
+    match manifest.get(path) {
+        Ok(Some(entry)) => (
+            RING_STATUS_FOUND,
+            RingVnode {
+                content_hash: entry.vnode.content_hash,
+                size: entry.vnode.size,
+                mtime: entry.vnode.mtime,
+                mode: entry.vnode.mode,
+                flags: entry.vnode.flags,
+                _pad: 0,
+            },
+        ),
+        Ok(None) => (RING_STATUS_NOT_FOUND, RingVnode::default()),
+        Err(e) => {
+            warn!(path = %path, error = %e, "Ring lookup: LMDB error");
+            (RING_STATUS_ERROR, RingVnode::default())
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use tempfile::tempdir;
+    use vrift_ipc::VnodeEntry;
+
+    #[tokio::test(flavor = "multi_thread")]
+    async fn test_ring_setup_and_lookup() {
+        let temp = tempdir().unwrap();
+        let mut config = ProjectConfig::from_project_root(temp.path().to_path_buf());
+        config.vdir_path = temp.path().join("test.vdir");
+
+        let manifest_path = temp.path().join("manifest.lmdb");
+        let manifest = Arc::new(
+            vrift_manifest::lmdb::LmdbManifest::open(&manifest_path).unwrap(),
+        );
+        manifest.insert(
+            "src/lib.rs",
+            VnodeEntry {
+                content_hash: [9; 32],
+                size: 321,
+                mtime: 1111,
+                mode: 0o644,
+                flags: 0,
+                _pad: 0,
+            },
+            vrift_manifest::lmdb::AssetTier::Tier2Mutable,
+        );
+
+        let service = RingService::new(config, manifest);
+        let (shm_path, slots) = match service.setup() {
+            VeloResponse::RingSetupAck { shm_path, slots } => (shm_path, slots),
+            other => panic!("Expected RingSetupAck, got {:?}", other),
+        };
+
+        // Attach as a client would and do a lookup through shared memory
+        let file = std::fs::OpenOptions::new()
+            .read(true)
+            .write(true)
+            .open(&shm_path)
+            .unwrap();
+        let mmap = unsafe { memmap2::MmapMut::map_mut(&file).unwrap() };
+        let ring = unsafe { ShmRing::from_raw(mmap.as_ptr(), ShmRing::required_size(slots)) }
+            .expect("ring should validate");
+
+        let client = tokio::task::spawn_blocking(move || {
+            let hit = ring.manifest_get(b"src/lib.rs").unwrap();
+            let miss = ring.manifest_get(b"src/missing.rs").unwrap();
+            (hit, miss)
+        });
+        let ((hit_status, hit_entry), (miss_status, _)) = client.await.unwrap();
+
+        assert_eq!(hit_status, RING_STATUS_FOUND);
+        assert_eq!(hit_entry.size, 321);
+        assert_eq!(hit_entry.content_hash, [9; 32]);
+        assert_eq!(miss_status, RING_STATUS_NOT_FOUND);
+    }
+}
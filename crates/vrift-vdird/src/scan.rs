@@ -1,10 +1,13 @@
 //! RFC-0039: Compensation Scan for Live Ingest (Layer 3)
 //!
 //! Scans project directory for changes that occurred while daemon was stopped.
-//! Uses mtime delta detection against manifest.
+//! Uses mtime delta detection against manifest. The walk is parallel
+//! (per-directory work stealing via jwalk, same shape as the streaming
+//! pipeline scanner) and all stats happen on the worker threads.
 
 use std::fs;
-use std::path::{Path, PathBuf};
+use std::path::PathBuf;
+use std::sync::Arc;
 use std::time::SystemTime;
 use tokio::sync::mpsc;
 use tracing::{debug, info, warn};
@@ -23,6 +26,14 @@ pub struct ScanConfig {
     pub ignore: IgnoreMatcher,
     /// Maximum depth to scan
     pub max_depth: usize,
+    /// Skip subtrees whose directory mtime predates `last_scan`.
+    ///
+    /// Rename-based writers (compilers, git) bump the parent directory
+    /// mtime, so their output is still found; files rewritten strictly
+    /// in place inside an otherwise untouched directory are missed.
+    /// Acceptable for the restart-time full-tree scan where walk cost
+    /// dominates; off by default so targeted rescans stay exact.
+    pub prune_unchanged_dirs: bool,
 }
 
 impl Default for ScanConfig {
@@ -32,6 +43,7 @@ impl Default for ScanConfig {
             last_scan: SystemTime::UNIX_EPOCH,
             ignore: IgnoreMatcher::new(),
             max_depth: 50,
+            prune_unchanged_dirs: false,
         }
     }
 }
@@ -53,69 +65,93 @@ impl CompensationScanner {
         }
     }
 
-    /// Check if path should be ignored
-    fn should_ignore(&self, path: &Path) -> bool {
-        self.config.ignore.should_ignore(path)
+    /// Enable or disable directory-mtime subtree pruning
+    pub fn with_pruning(mut self, prune: bool) -> Self {
+        self.config.prune_unchanged_dirs = prune;
+        self
     }
 
     /// Scan directory and emit events for changed files
+    ///
+    /// The walk fans out one rayon task per directory; each worker stats
+    /// its own children and classifies them in place, so the consumer
+    /// loop only collects. The result is one path-sorted batch ready for
+    /// the ingest loop's bulk processing.
     pub fn scan(&self) -> Vec<IngestEvent> {
-        let mut events = Vec::new();
-        self.scan_dir(&self.config.root, 0, &mut events);
-        events
-    }
+        // Per-entry client state carries the classified event out of the
+        // worker threads
+        type ScanWalk = jwalk::WalkDirGeneric<((), Option<IngestEvent>)>;
 
-    /// Recursive directory scan
-    fn scan_dir(&self, dir: &Path, depth: usize, events: &mut Vec<IngestEvent>) {
-        if depth > self.config.max_depth {
-            return;
-        }
+        let cfg = Arc::new(self.config.clone());
+        let walk_cfg = Arc::clone(&cfg);
 
-        let entries = match fs::read_dir(dir) {
-            Ok(e) => e,
-            Err(e) => {
-                warn!(path = %dir.display(), error = %e, "Failed to read directory");
-                return;
-            }
-        };
+        let walker = ScanWalk::new(&self.config.root)
+            .skip_hidden(false)
+            .max_depth(self.config.max_depth)
+            .process_read_dir(move |depth, _dir, _state, children| {
+                // depth None is jwalk's synthetic frame holding the root
+                // entry itself; the root is never an event and always walked
+                if depth.is_none() {
+                    return;
+                }
+                children.retain(|result| {
+                    result
+                        .as_ref()
+                        .map(|e| !walk_cfg.ignore.should_ignore(&e.path()))
+                        .unwrap_or(true)
+                });
 
-        for entry in entries.flatten() {
-            let path = entry.path();
+                for child in children.iter_mut().flatten() {
+                    let path = child.path();
+                    let metadata = match fs::symlink_metadata(&path) {
+                        Ok(m) => m,
+                        Err(_) => {
+                            child.read_children_path = None;
+                            continue;
+                        }
+                    };
+                    let mtime = metadata.modified().unwrap_or(SystemTime::UNIX_EPOCH);
 
-            if self.should_ignore(&path) {
-                continue;
-            }
+                    // Prune subtrees whose directory is untouched since the
+                    // last scan (see ScanConfig::prune_unchanged_dirs)
+                    if child.file_type.is_dir()
+                        && walk_cfg.prune_unchanged_dirs
+                        && mtime <= walk_cfg.last_scan
+                    {
+                        child.read_children_path = None;
+                    }
 
-            let metadata = match entry.metadata() {
-                Ok(m) => m,
-                Err(_) => continue,
-            };
-
-            let mtime = metadata.modified().unwrap_or(SystemTime::UNIX_EPOCH);
-
-            // Check if file was modified after last scan
-            if mtime > self.config.last_scan {
-                if metadata.is_dir() {
-                    debug!(path = %path.display(), "Compensation: new directory");
-                    events.push(IngestEvent::DirCreated { path: path.clone() });
-                } else if metadata.is_symlink() {
-                    let target = fs::read_link(&path).unwrap_or_default();
-                    debug!(path = %path.display(), "Compensation: new symlink");
-                    events.push(IngestEvent::SymlinkCreated {
-                        path: path.clone(),
-                        target,
-                    });
-                } else {
-                    debug!(path = %path.display(), "Compensation: changed file");
-                    events.push(IngestEvent::FileChanged { path: path.clone() });
+                    // Check if entry was modified after last scan
+                    if mtime > walk_cfg.last_scan {
+                        child.client_state = Some(if child.file_type.is_dir() {
+                            debug!(path = %path.display(), "Compensation: new directory");
+                            IngestEvent::DirCreated { path }
+                        } else if child.file_type.is_symlink() {
+                            let target = fs::read_link(&path).unwrap_or_default();
+                            debug!(path = %path.display(), "Compensation: new symlink");
+                            IngestEvent::SymlinkCreated { path, target }
+                        } else {
+                            debug!(path = %path.display(), "Compensation: changed file");
+                            IngestEvent::FileChanged { path }
+                        });
+                    }
                 }
-            }
+            });
 
-            // Recurse into directories
-            if metadata.is_dir() {
-                self.scan_dir(&path, depth + 1, events);
-            }
-        }
+        let mut events: Vec<IngestEvent> = walker
+            .into_iter()
+            .filter_map(|entry| match entry {
+                Ok(e) => e.client_state,
+                Err(e) => {
+                    warn!(error = %e, "Compensation scan error");
+                    None
+                }
+            })
+            .collect();
+
+        // Sorted batch for the downstream bulk LMDB writes
+        events.sort_by(|a, b| crate::watch::event_path(a).cmp(crate::watch::event_path(b)));
+        events
     }
 }
 
@@ -127,7 +163,8 @@ pub async fn run_compensation_scan(
 ) -> usize {
     info!(root = %root.display(), "Starting compensation scan");
 
-    let scanner = CompensationScanner::new(root, last_scan);
+    // Restart-time full-tree scan: walk cost dominates, prune aggressively
+    let scanner = CompensationScanner::new(root, last_scan).with_pruning(true);
     let events = scanner.scan();
     let count = events.len();
 
@@ -145,6 +182,7 @@ pub async fn run_compensation_scan(
 #[cfg(test)]
 mod tests {
     use super::*;
+    use std::path::Path;
     use tempfile::tempdir;
 
     #[test]
@@ -194,4 +232,68 @@ mod tests {
             }
         }));
     }
+
+    #[test]
+    fn test_scan_output_is_path_sorted() {
+        let dir = tempdir().unwrap();
+        let root = dir.path().to_path_buf();
+
+        fs::write(root.join("zebra.txt"), "z").unwrap();
+        fs::create_dir(root.join("mid")).unwrap();
+        fs::write(root.join("mid/inner.txt"), "i").unwrap();
+        fs::write(root.join("alpha.txt"), "a").unwrap();
+
+        let scanner = CompensationScanner::new(root, SystemTime::UNIX_EPOCH);
+        let events = scanner.scan();
+
+        let paths: Vec<_> = events
+            .iter()
+            .map(|e| crate::watch::event_path(e).to_path_buf())
+            .collect();
+        let mut sorted = paths.clone();
+        sorted.sort();
+        assert_eq!(paths, sorted);
+        assert_eq!(paths.len(), 4);
+    }
+
+    #[test]
+    fn test_scan_prunes_unchanged_subtrees() {
+        let dir = tempdir().unwrap();
+        let root = dir.path().to_path_buf();
+
+        let old_dir = root.join("untouched");
+        fs::create_dir(&old_dir).unwrap();
+        let stale = old_dir.join("stale.txt");
+        fs::write(&stale, "rewritten in place").unwrap();
+        fs::write(root.join("fresh.txt"), "new").unwrap();
+
+        // The files are newer than last_scan, but the subtree's directory
+        // mtime predates it — as if a file was rewritten in place without
+        // any create/rename touching the directory
+        let last_scan = SystemTime::now() - std::time::Duration::from_secs(60);
+        set_mtime(&old_dir, SystemTime::now() - std::time::Duration::from_secs(3600));
+
+        let scanner = CompensationScanner::new(root.clone(), last_scan).with_pruning(true);
+        let events = scanner.scan();
+
+        // fresh.txt found, the pruned subtree's contents skipped
+        assert!(events.iter().any(
+            |e| matches!(e, IngestEvent::FileChanged { path } if path.ends_with("fresh.txt"))
+        ));
+        assert!(!events
+            .iter()
+            .any(|e| crate::watch::event_path(e) == stale.as_path()));
+
+        // Without pruning (the exact mode) the in-place change is found
+        let scanner = CompensationScanner::new(root, last_scan);
+        let events = scanner.scan();
+        assert!(events
+            .iter()
+            .any(|e| crate::watch::event_path(e) == stale.as_path()));
+    }
+
+    /// Backdate a path's mtime
+    fn set_mtime(path: &Path, mtime: SystemTime) {
+        fs::File::open(path).unwrap().set_modified(mtime).unwrap();
+    }
 }
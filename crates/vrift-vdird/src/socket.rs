@@ -30,15 +30,17 @@ pub async fn run_listener(
     let handler = Arc::new(RwLock::new(CommandHandler::new(
         config.clone(),
         vdir,
-        manifest,
+        Arc::clone(&manifest),
     )));
+    let ring_service = Arc::new(crate::ring::RingService::new(config, manifest));
 
     loop {
         match listener.accept().await {
             Ok((stream, _addr)) => {
                 let handler = Arc::clone(&handler);
+                let ring_service = Arc::clone(&ring_service);
                 tokio::spawn(async move {
-                    if let Err(e) = handle_client(stream, handler).await {
+                    if let Err(e) = handle_client(stream, handler, ring_service).await {
                         warn!(error = %e, "Client handler error");
                     }
                 });
@@ -51,7 +53,11 @@ pub async fn run_listener(
 }
 
 /// Handle a single client connection using IpcHeader frame protocol
-async fn handle_client(mut stream: UnixStream, handler: Arc<RwLock<CommandHandler>>) -> Result<()> {
+async fn handle_client(
+    mut stream: UnixStream,
+    handler: Arc<RwLock<CommandHandler>>,
+    ring_service: Arc<crate::ring::RingService>,
+) -> Result<()> {
     debug!("New client connected");
 
     loop {
@@ -129,8 +135,16 @@ async fn handle_client(mut stream: UnixStream, handler: Arc<RwLock<CommandHandle
 
         debug!(?request, "Received request");
 
-        // Handle request
-        let response = {
+        // Handle request. Ring negotiation bypasses the handler lock
+        // entirely; read-shaped commands share the lock so concurrent
+        // clients never queue behind each other; only mutations are
+        // exclusive.
+        let response = if matches!(request, VeloRequest::RingSetup) {
+            ring_service.setup()
+        } else if crate::commands::is_read_only(&request) {
+            let h = handler.read().await;
+            h.handle_read_request(request).await
+        } else {
             let mut h = handler.write().await;
             h.handle_request(request).await
         };
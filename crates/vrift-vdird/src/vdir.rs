@@ -149,6 +149,11 @@ impl VDir {
         }
     }
 
+    /// Current seqlock generation (even = stable snapshot)
+    pub fn generation(&self) -> u64 {
+        self.header().generation
+    }
+
     /// Open an existing VDir in read-only mode (for observability)
     pub fn open_readonly(path: &Path) -> Result<Self> {
         let file = OpenOptions::new()
@@ -340,6 +345,85 @@ impl VDir {
         }
     }
 
+    /// RFC-0044: Hydrate the VDir from a full LMDB manifest snapshot.
+    ///
+    /// Called once at daemon startup so the mmap is a complete snapshot of the
+    /// committed manifest before any client maps it. This lets the inception
+    /// layer answer the entire stat phase of a warm build from shared memory
+    /// without a single socket round trip.
+    ///
+    /// All entries are inserted inside ONE seqlock write transaction: readers
+    /// either see the pre-hydration table or the fully hydrated one, never a
+    /// partial snapshot. Returns the number of entries loaded.
+    pub fn hydrate_from_manifest(
+        &mut self,
+        manifest: &vrift_manifest::lmdb::LmdbManifest,
+    ) -> Result<usize> {
+        let entries = manifest
+            .iter()
+            .map_err(|e| anyhow::anyhow!("manifest iteration failed: {}", e))?;
+
+        if entries.is_empty() {
+            return Ok(0);
+        }
+
+        // Pre-size the table so hydration never triggers a mid-transaction resize.
+        let current_count = self.header().entry_count as usize;
+        let mut needed_capacity = self.capacity;
+        while (current_count + entries.len()) as f64 / needed_capacity as f64 > 0.75 {
+            needed_capacity *= 2;
+        }
+        if needed_capacity > self.capacity {
+            self.resize(needed_capacity)?;
+        }
+
+        self.begin_write();
+        let mut loaded = 0usize;
+        for (path, manifest_entry) in &entries {
+            let vnode = &manifest_entry.vnode;
+            // Translate VnodeEntry flags (bit0=dir, bit1=symlink) to VDir flags
+            let mut flags = 0u16;
+            if vnode.is_dir() {
+                flags |= FLAG_DIR;
+            }
+            if vnode.flags & 2 != 0 {
+                flags |= FLAG_SYMLINK;
+            }
+
+            let entry = VDirEntry {
+                path_hash: fnv1a_hash(path),
+                cas_hash: vnode.content_hash,
+                size: vnode.size,
+                mtime_sec: vnode.mtime as i64,
+                mtime_nsec: 0,
+                mode: vnode.mode,
+                flags,
+                _pad: [0; 3],
+            };
+
+            let slot = match self.find_slot(entry.path_hash) {
+                Some(s) => s,
+                None => {
+                    // Table full despite pre-sizing (pathological collisions) —
+                    // finish the transaction cleanly and report what we loaded.
+                    warn!(path = %path, "VDir full during hydration, stopping early");
+                    break;
+                }
+            };
+
+            let is_new = self.entries()[slot].is_empty();
+            self.entries_mut()[slot] = entry;
+            if is_new {
+                self.header_mut().entry_count += 1;
+            }
+            loaded += 1;
+        }
+        self.end_write();
+        self.flush()?;
+
+        Ok(loaded)
+    }
+
     /// Resize VDir to a new capacity.
     /// Rehashes all existing entries into a larger table.
     pub fn resize(&mut self, new_capacity: usize) -> Result<()> {
@@ -1109,6 +1193,69 @@ mod tests {
         }
     }
 
+    // ==================== Manifest Hydration ====================
+
+    #[test]
+    fn test_hydrate_from_manifest_snapshot() {
+        use vrift_manifest::lmdb::{AssetTier, LmdbManifest};
+        use vrift_manifest::VnodeEntry;
+
+        let temp = tempdir().unwrap();
+        let vdir_path = temp.path().join("hydrate.vdir");
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+
+        // Seed manifest: committed base entries + uncommitted delta
+        manifest.insert(
+            "/src/main.rs",
+            VnodeEntry::new_file([0xAA; 32], 4096, 1706448000, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+        manifest.insert(
+            "/src",
+            VnodeEntry::new_directory(1706448000, 0o755),
+            AssetTier::Tier2Mutable,
+        );
+        manifest.commit().unwrap();
+        manifest.insert(
+            "/src/lib.rs",
+            VnodeEntry::new_file([0xBB; 32], 128, 1706448001, 0o644),
+            AssetTier::Tier2Mutable,
+        );
+
+        let mut vdir = VDir::create_or_open(&vdir_path).unwrap();
+        let loaded = vdir.hydrate_from_manifest(&manifest).unwrap();
+        assert_eq!(loaded, 3);
+        assert_eq!(vdir.header().entry_count, 3);
+
+        // File entries carry size + hash, directories carry FLAG_DIR
+        let file = vdir.lookup(fnv1a_hash("/src/main.rs")).unwrap();
+        assert_eq!(file.size, 4096);
+        assert_eq!(file.cas_hash, [0xAA; 32]);
+        assert!(!file.is_dir());
+
+        let dir = vdir.lookup(fnv1a_hash("/src")).unwrap();
+        assert!(dir.is_dir());
+
+        // Delta-layer (uncommitted) entries are part of the snapshot too
+        assert!(vdir.lookup(fnv1a_hash("/src/lib.rs")).is_some());
+
+        // Hydration is one seqlock transaction: generation stays even
+        assert_eq!(vdir.header().generation & 1, 0);
+    }
+
+    #[test]
+    fn test_hydrate_empty_manifest_is_noop() {
+        use vrift_manifest::lmdb::LmdbManifest;
+
+        let temp = tempdir().unwrap();
+        let manifest = LmdbManifest::open(temp.path().join("manifest")).unwrap();
+
+        let mut vdir = VDir::create_or_open(&temp.path().join("empty.vdir")).unwrap();
+        let gen_before = vdir.header().generation;
+        assert_eq!(vdir.hydrate_from_manifest(&manifest).unwrap(), 0);
+        assert_eq!(vdir.header().generation, gen_before);
+    }
+
     /// Test automatic resizing when load factor > 0.75
     #[test]
     fn test_vdir_resize() {
@@ -4,9 +4,10 @@
 //! Uses FSEvents on macOS, inotify on Linux.
 
 use notify::{Config, Event, RecommendedWatcher, RecursiveMode, Watcher};
+use std::collections::{BTreeMap, HashMap};
 use std::path::{Path, PathBuf};
 use std::sync::mpsc::{self, Receiver};
-use std::time::Duration;
+use std::time::{Duration, Instant, SystemTime};
 use tokio::sync::mpsc as tokio_mpsc;
 use tracing::{debug, info, warn};
 
@@ -145,6 +146,173 @@ impl FsWatch {
     }
 }
 
+// ============================================================================
+// Event Coalescing (debounced batch re-ingest)
+// ============================================================================
+
+/// Pending events above this collapse to batch mode: per-path merge plus
+/// directory-storm detection instead of per-event forwarding.
+const STORM_THRESHOLD: usize = 512;
+
+/// A directory with this many pending events is a storm (git checkout,
+/// branch switch) — its events are dropped in favor of one subtree rescan.
+const DIR_COLLAPSE_THRESHOLD: usize = 64;
+
+/// Hard cap on how long events may sit in the coalescer while new ones keep
+/// arriving, so the manifest never lags the filesystem by more than this.
+const MAX_COALESCE_DELAY: Duration = Duration::from_secs(2);
+
+/// Debounced event coalescer between the raw watcher and the ingest queue.
+///
+/// Single-file saves stay real-time: an isolated event flushes after one
+/// debounce window. Under a storm (a `git checkout` touching tens of
+/// thousands of paths) events merge per path — last writer wins — and
+/// directories with heavy churn collapse into one `CompensationScanner`
+/// subtree rescan instead of an event per file. Flushes are path-sorted so
+/// the ingest loop's batches line up with the bulk LMDB writer's sorted
+/// insertion order.
+pub struct EventCoalescer {
+    /// Quiet period required before a flush (the debounce window)
+    window: Duration,
+    /// Pending events, keyed by path (BTreeMap → sorted flush for free)
+    pending: BTreeMap<PathBuf, IngestEvent>,
+    /// When the oldest pending event was absorbed
+    first_pending_at: Option<Instant>,
+    /// When the most recent event was absorbed
+    last_absorb_at: Option<Instant>,
+}
+
+impl EventCoalescer {
+    pub fn new(window: Duration) -> Self {
+        Self {
+            window,
+            pending: BTreeMap::new(),
+            first_pending_at: None,
+            last_absorb_at: None,
+        }
+    }
+
+    /// Merge raw watcher events into the pending set (last event per path wins).
+    pub fn absorb(&mut self, events: Vec<IngestEvent>) {
+        if events.is_empty() {
+            return;
+        }
+        let now = Instant::now();
+        self.first_pending_at.get_or_insert(now);
+        self.last_absorb_at = Some(now);
+
+        for event in events {
+            let path = match &event {
+                IngestEvent::FileChanged { path } => path,
+                IngestEvent::DirCreated { path } => path,
+                IngestEvent::Removed { path } => path,
+                IngestEvent::SymlinkCreated { path, .. } => path,
+            };
+            self.pending.insert(path.clone(), event);
+        }
+    }
+
+    /// Whether the pending set has crossed into batch (storm) mode.
+    pub fn is_storm(&self) -> bool {
+        self.pending.len() >= STORM_THRESHOLD
+    }
+
+    /// Whether the pending set should flush now: quiet for one debounce
+    /// window, or held longer than the hard cap under sustained churn.
+    pub fn should_flush(&self) -> bool {
+        if self.pending.is_empty() {
+            return false;
+        }
+        let quiet = self
+            .last_absorb_at
+            .is_some_and(|t| t.elapsed() >= self.window);
+        let overdue = self
+            .first_pending_at
+            .is_some_and(|t| t.elapsed() >= MAX_COALESCE_DELAY);
+        quiet || overdue
+    }
+
+    /// Drain the pending set as one path-sorted batch.
+    ///
+    /// In storm mode, directories with `DIR_COLLAPSE_THRESHOLD`+ pending
+    /// events are collapsed: their per-file events are discarded and the
+    /// subtree is rescanned with the `CompensationScanner` against
+    /// `since`, which also picks up anything inotify dropped under
+    /// pressure. `Removed` events are always forwarded individually — a
+    /// rescan cannot observe deletions.
+    pub fn flush(&mut self, since: SystemTime) -> Vec<IngestEvent> {
+        let storm = self.is_storm();
+        let pending = std::mem::take(&mut self.pending);
+        self.first_pending_at = None;
+        self.last_absorb_at = None;
+
+        if !storm {
+            return pending.into_values().collect();
+        }
+
+        // Count non-Removed churn per parent directory
+        let mut dir_counts: HashMap<PathBuf, usize> = HashMap::new();
+        for (path, event) in &pending {
+            if matches!(event, IngestEvent::Removed { .. }) {
+                continue;
+            }
+            if let Some(parent) = path.parent() {
+                *dir_counts.entry(parent.to_path_buf()).or_insert(0) += 1;
+            }
+        }
+        let mut storm_dirs: Vec<PathBuf> = dir_counts
+            .into_iter()
+            .filter(|(_, n)| *n >= DIR_COLLAPSE_THRESHOLD)
+            .map(|(dir, _)| dir)
+            .collect();
+        // Drop storm dirs nested under other storm dirs — the ancestor's
+        // rescan covers them
+        storm_dirs.sort();
+        storm_dirs.dedup_by(|b, a| b.starts_with(&a));
+
+        let mut events: Vec<IngestEvent> = Vec::new();
+
+        // One subtree rescan replaces each directory storm
+        for dir in &storm_dirs {
+            debug!(dir = %dir.display(), "Storm collapse: rescanning subtree");
+            let scanner = crate::scan::CompensationScanner::new(dir.clone(), since);
+            events.extend(scanner.scan());
+        }
+
+        // Forward everything not covered by a rescan (plus all removals)
+        for (path, event) in pending {
+            let removed = matches!(event, IngestEvent::Removed { .. });
+            let covered = !removed && storm_dirs.iter().any(|d| path.starts_with(d));
+            if !covered {
+                events.push(event);
+            }
+        }
+
+        // Path-sorted batch for the bulk LMDB writer downstream
+        events.sort_by(|a, b| event_path(a).cmp(event_path(b)));
+        info!(
+            count = events.len(),
+            storms = storm_dirs.len(),
+            "Coalescer flushed batch"
+        );
+        events
+    }
+
+    /// Pending events awaiting flush.
+    pub fn pending_count(&self) -> usize {
+        self.pending.len()
+    }
+}
+
+pub(crate) fn event_path(event: &IngestEvent) -> &Path {
+    match event {
+        IngestEvent::FileChanged { path } => path,
+        IngestEvent::DirCreated { path } => path,
+        IngestEvent::Removed { path } => path,
+        IngestEvent::SymlinkCreated { path, .. } => path,
+    }
+}
+
 /// Spawn async watcher task that sends events to a channel
 pub fn spawn_watch_task(
     root: PathBuf,
@@ -159,14 +327,23 @@ pub fn spawn_watch_task(
             }
         };
 
-        loop {
-            // Poll for events
-            let events = watcher.poll();
+        let mut coalescer = EventCoalescer::new(watcher.config.debounce);
+        let mut last_flush = SystemTime::now();
 
-            for event in events {
-                if tx.send(event).await.is_err() {
-                    // Channel closed, exit
-                    return;
+        loop {
+            // Poll for events and merge into the pending set
+            coalescer.absorb(watcher.poll());
+
+            // Flush once quiet (real-time for single saves) or overdue
+            // (sustained storms degrade to periodic sorted batches)
+            if coalescer.should_flush() {
+                let batch = coalescer.flush(last_flush);
+                last_flush = SystemTime::now();
+                for event in batch {
+                    if tx.send(event).await.is_err() {
+                        // Channel closed, exit
+                        return;
+                    }
                 }
             }
 
@@ -218,4 +395,108 @@ mod tests {
         assert!(config.ignore.should_ignore(Path::new(".vrift")));
         assert!(config.ignore.should_ignore(Path::new(".DS_Store")));
     }
+
+    #[test]
+    fn test_coalescer_merges_per_path() {
+        let mut c = EventCoalescer::new(Duration::from_millis(0));
+        let p = PathBuf::from("/project/src/main.rs");
+        c.absorb(vec![
+            IngestEvent::FileChanged { path: p.clone() },
+            IngestEvent::FileChanged { path: p.clone() },
+            IngestEvent::Removed { path: p.clone() },
+        ]);
+        assert_eq!(c.pending_count(), 1);
+
+        let batch = c.flush(SystemTime::now());
+        assert_eq!(batch.len(), 1);
+        // Last event per path wins
+        assert!(matches!(&batch[0], IngestEvent::Removed { path } if *path == p));
+        assert_eq!(c.pending_count(), 0);
+    }
+
+    #[test]
+    fn test_coalescer_flush_is_path_sorted() {
+        let mut c = EventCoalescer::new(Duration::from_millis(0));
+        c.absorb(vec![
+            IngestEvent::FileChanged {
+                path: PathBuf::from("/project/z.rs"),
+            },
+            IngestEvent::FileChanged {
+                path: PathBuf::from("/project/a.rs"),
+            },
+            IngestEvent::FileChanged {
+                path: PathBuf::from("/project/m.rs"),
+            },
+        ]);
+        let batch = c.flush(SystemTime::now());
+        let paths: Vec<_> = batch.iter().map(|e| event_path(e).to_path_buf()).collect();
+        let mut sorted = paths.clone();
+        sorted.sort();
+        assert_eq!(paths, sorted);
+    }
+
+    #[test]
+    fn test_coalescer_quiet_window() {
+        let mut c = EventCoalescer::new(Duration::from_millis(500));
+        assert!(!c.should_flush()); // nothing pending
+
+        c.absorb(vec![IngestEvent::FileChanged {
+            path: PathBuf::from("/project/src/lib.rs"),
+        }]);
+        // Just absorbed — still inside the debounce window
+        assert!(!c.should_flush());
+
+        // Zero-width window flushes immediately once quiet
+        let mut c = EventCoalescer::new(Duration::from_millis(0));
+        c.absorb(vec![IngestEvent::FileChanged {
+            path: PathBuf::from("/project/src/lib.rs"),
+        }]);
+        assert!(c.should_flush());
+    }
+
+    #[test]
+    fn test_coalescer_storm_collapses_to_rescan() {
+        let dir = tempfile::tempdir().unwrap();
+        let storm_dir = dir.path().join("generated");
+        std::fs::create_dir(&storm_dir).unwrap();
+
+        // A real file the rescan should rediscover
+        std::fs::write(storm_dir.join("out.o"), b"obj").unwrap();
+
+        let since = SystemTime::now() - Duration::from_secs(60);
+        let mut c = EventCoalescer::new(Duration::from_millis(0));
+
+        // Enough churn in one directory to trip both thresholds
+        let mut events = Vec::new();
+        for i in 0..STORM_THRESHOLD {
+            events.push(IngestEvent::FileChanged {
+                path: storm_dir.join(format!("tmp_{i}.o")),
+            });
+        }
+        // A removal inside the storm dir, and a lone change elsewhere
+        let removed = storm_dir.join("stale.o");
+        events.push(IngestEvent::Removed {
+            path: removed.clone(),
+        });
+        let lone = dir.path().join("main.rs");
+        events.push(IngestEvent::FileChanged { path: lone.clone() });
+        c.absorb(events);
+        assert!(c.is_storm());
+
+        let batch = c.flush(since);
+        // Per-file storm events were discarded; the rescan found only what
+        // actually exists on disk
+        assert!(batch.len() < STORM_THRESHOLD);
+        assert!(batch
+            .iter()
+            .any(|e| matches!(e, IngestEvent::FileChanged { path } if *path == storm_dir.join("out.o"))));
+        // Removals survive the collapse — a rescan can't observe them
+        assert!(batch
+            .iter()
+            .any(|e| matches!(e, IngestEvent::Removed { path } if *path == removed)));
+        // Events outside the storm dir are forwarded untouched
+        assert!(batch
+            .iter()
+            .any(|e| matches!(e, IngestEvent::FileChanged { path } if *path == lone)));
+    }
 }